@@ -0,0 +1,348 @@
+#include "DataFrameUtils.h"
+#include "SequentialNN.h"
+#include "LinearLayer.h"
+#include "ActivationLayer.h"
+#include "Activations.h"
+#include "BCELoss.h"
+#include "BCEWithLogitsLoss.h"
+#include "LearningFacade.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef BENCH_DATASET_DIR
+#define BENCH_DATASET_DIR "datasets"
+#endif
+
+namespace {
+    struct Options {
+        size_t warmup = 2;
+        size_t repetitions = 10;
+        std::string filter;
+        std::string json_path = "bench_results.json";
+        std::string baseline_path;
+        double threshold = 0.10;
+        std::string dataset_dir = BENCH_DATASET_DIR;
+    };
+
+    // Work done by one repetition, used to turn times into rates.
+    struct Work {
+        double items = 0.0;
+        double flops = 0.0;
+        double bytes = 0.0;
+    };
+
+    struct Result {
+        std::string name;
+        size_t repetitions;
+        double mean_ns;
+        double stddev_ns;
+        double min_ns;
+        double items_per_second;
+        double gflops;
+        double mb_per_second;
+    };
+
+    // Keeps benchmark results observable so the compiler cannot drop the work.
+    volatile long double sink = 0.0L;
+
+    // Redirects std::cout while training so progress bars do not interleave with the report.
+    class SilenceStdout {
+    private:
+        std::ostringstream discard;
+        std::streambuf* previous;
+
+    public:
+        SilenceStdout() : previous(std::cout.rdbuf(discard.rdbuf())) {}
+        ~SilenceStdout() { std::cout.rdbuf(previous); }
+    };
+
+    class Harness {
+    private:
+        const Options& options;
+        std::vector<Result> results;
+
+    public:
+        explicit Harness(const Options& options) : options(options) {}
+
+        void run(const std::string& name, const Work& work, const std::function<void()>& body) {
+            if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+                return;
+            }
+
+            for (size_t i = 0; i < options.warmup; ++i) {
+                body();
+            }
+
+            std::vector<double> times(options.repetitions);
+            for (size_t i = 0; i < options.repetitions; ++i) {
+                auto start = std::chrono::steady_clock::now();
+                body();
+                auto end = std::chrono::steady_clock::now();
+                times[i] = std::chrono::duration<double, std::nano>(end - start).count();
+            }
+
+            double mean = 0.0;
+            for (double t : times) {
+                mean += t;
+            }
+            mean /= times.size();
+            double variance = 0.0;
+            for (double t : times) {
+                variance += (t - mean) * (t - mean);
+            }
+            variance /= times.size() > 1 ? times.size() - 1 : 1;
+
+            double seconds = mean * 1e-9;
+            Result result{name, options.repetitions, mean, std::sqrt(variance),
+                          *std::min_element(times.begin(), times.end()),
+                          work.items / seconds, work.flops / seconds * 1e-9, work.bytes / seconds * 1e-6};
+            results.push_back(result);
+
+            std::cerr << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(3)
+                      << std::setw(14) << mean * 1e-6 << " ms  +/- " << std::setw(8) << std::sqrt(variance) * 1e-6
+                      << " ms" << std::setprecision(1);
+            if (work.items > 0) std::cerr << std::setw(14) << result.items_per_second << " items/s";
+            if (work.flops > 0) std::cerr << std::setw(10) << std::setprecision(3) << result.gflops << " GFLOP/s";
+            if (work.bytes > 0) std::cerr << std::setw(10) << std::setprecision(1) << result.mb_per_second << " MB/s";
+            std::cerr << "\n";
+        }
+
+        const std::vector<Result>& get_results() const {
+            return results;
+        }
+    };
+
+    std::vector<long double> random_vector(size_t size, std::default_random_engine& generator) {
+        std::normal_distribution<long double> dist(0.0L, 1.0L);
+        std::vector<long double> values(size);
+        for (auto& v : values) {
+            v = dist(generator);
+        }
+        return values;
+    }
+
+    double file_size(const std::string& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        return static_cast<double>(file.tellg());
+    }
+
+    void bench_linear(Harness& harness, std::default_random_engine& generator) {
+        const std::vector<std::pair<size_t, size_t>> shapes = {{31, 64}, {64, 32}, {256, 256}, {1024, 1024}};
+        for (const auto& [in, out] : shapes) {
+            LinearLayer layer(in, out);
+            auto input = random_vector(in, generator);
+            auto gradient = random_vector(out, generator);
+            size_t samples = std::max<size_t>(1, (1u << 22) / (in * out));
+            double weight_bytes = static_cast<double>(in * out * sizeof(long double));
+            std::string shape = std::to_string(in) + "x" + std::to_string(out);
+
+            harness.run("linear/forward/" + shape, {double(samples), 2.0 * in * out * samples, weight_bytes * samples},
+                        [&]() {
+                for (size_t s = 0; s < samples; ++s) {
+                    sink = sink + layer.forward(input)[0];
+                }
+            });
+            harness.run("linear/backward/" + shape, {double(samples), 4.0 * in * out * samples, 2.0 * weight_bytes * samples},
+                        [&]() {
+                for (size_t s = 0; s < samples; ++s) {
+                    sink = sink + layer.backward(gradient)[0];
+                }
+            });
+        }
+    }
+
+    void bench_activations(Harness& harness, std::default_random_engine& generator) {
+        using ActivationFn = std::vector<long double> (*)(const std::vector<long double>&);
+        const std::vector<std::pair<std::string, ActivationFn>> functions = {
+            {"relu", Activations::relu}, {"relu_derivative", Activations::relu_derivative},
+            {"sigmoid", Activations::sigmoid}, {"sigmoid_derivative", Activations::sigmoid_derivative},
+            {"tanh", Activations::tanh}, {"tanh_derivative", Activations::tanh_derivative},
+        };
+        const size_t size = 1 << 16;
+        auto input = random_vector(size, generator);
+
+        for (const auto& [name, fn] : functions) {
+            harness.run("activation/" + name, {double(size), 0.0, 2.0 * size * sizeof(long double)}, [&, fn = fn]() {
+                sink = sink + fn(input)[0];
+            });
+        }
+    }
+
+    void bench_losses(Harness& harness, std::default_random_engine& generator) {
+        const size_t batch = 1 << 14;
+        std::uniform_real_distribution<long double> probability(0.01L, 0.99L);
+        std::vector<long double> predictions(batch), targets(batch), gradients(batch);
+        for (size_t i = 0; i < batch; ++i) {
+            predictions[i] = probability(generator);
+            targets[i] = probability(generator) > 0.5L ? 1.0L : 0.0L;
+        }
+        Work work{double(batch), 0.0, 3.0 * batch * sizeof(long double)};
+
+        BinaryCrossEntropyLoss bce;
+        harness.run("loss/bce", work, [&]() {
+            sink = sink + bce.compute_loss_and_gradient(predictions.data(), targets.data(), gradients.data(), batch, 1);
+        });
+        BCEWithLogitsLoss logits;
+        harness.run("loss/bce_with_logits", work, [&]() {
+            sink = sink + logits.compute_loss_and_gradient(predictions.data(), targets.data(), gradients.data(), batch, 1);
+        });
+    }
+
+    void bench_data(Harness& harness, const Options& options) {
+        std::string csv = options.dataset_dir + "/cancer/data.csv";
+        std::string json = options.dataset_dir + "/cancer/data.json";
+
+        DataFrame data = DataFrameUtils::df_from_csv(csv);
+        double rows = static_cast<double>(data.row_count());
+
+        harness.run("data/df_from_csv", {rows, 0.0, file_size(csv)}, [&]() {
+            sink = sink + DataFrameUtils::df_from_csv(csv).row_count();
+        });
+        harness.run("data/df_from_json", {rows, 0.0, file_size(json)}, [&]() {
+            sink = sink + DataFrameUtils::df_from_json(json).row_count();
+        });
+
+        auto target = data.dataframe_from_column("Column_2");
+        data.drop_columns({"Column_2"});
+        double bytes = rows * (data.column_count() + 1) * sizeof(long double);
+        harness.run("data/train_test_split", {rows, 0.0, bytes}, [&]() {
+            auto split = DataFrameUtils::train_test_split(data, *target, 0.2f);
+            sink = sink + std::get<0>(split).row_count();
+        });
+    }
+
+    void bench_training(Harness& harness, const Options& options) {
+        DataFrame data = DataFrameUtils::df_from_csv(options.dataset_dir + "/cancer/data.csv");
+        auto target = data.dataframe_from_column("Column_2");
+        data.drop_columns({"Column_2"});
+        auto train_loader = data.create_iterator();
+        auto target_loader = target->create_iterator();
+
+        Sequential model;
+        model.add_module(std::make_shared<LinearLayer>(data.column_count(), 64));
+        model.add_module(std::make_shared<ActivationLayer>(Activations::tanh, Activations::tanh_derivative));
+        model.add_module(std::make_shared<LinearLayer>(64, 32));
+        model.add_module(std::make_shared<ActivationLayer>(Activations::tanh, Activations::tanh_derivative));
+        model.add_module(std::make_shared<LinearLayer>(32, 1));
+
+        double rows = static_cast<double>(data.row_count());
+        double flops = 6.0 * (data.column_count() * 64 + 64 * 32 + 32) * rows;
+        harness.run("facade/train_epoch", {rows, flops, 0.0}, [&]() {
+            SilenceStdout silence;
+            LearningFacade facade(model, std::make_shared<BCEWithLogitsLoss>(), 1);
+            facade.train(*train_loader, *target_loader, 0.001L);
+        });
+        harness.run("facade/evaluate", {rows, flops / 3.0, 0.0}, [&]() {
+            LearningFacade facade(model, std::make_shared<BCEWithLogitsLoss>(), 0);
+            sink = sink + facade.evaluate(*train_loader, *target_loader, 1).loss;
+        });
+    }
+
+    nlohmann::json to_json(const std::vector<Result>& results) {
+        nlohmann::json benchmarks = nlohmann::json::array();
+        for (const auto& r : results) {
+            benchmarks.push_back({{"name", r.name}, {"repetitions", r.repetitions}, {"mean_ns", r.mean_ns},
+                                  {"stddev_ns", r.stddev_ns}, {"min_ns", r.min_ns},
+                                  {"items_per_second", r.items_per_second}, {"gflops", r.gflops},
+                                  {"mb_per_second", r.mb_per_second}});
+        }
+        return {{"benchmarks", benchmarks}};
+    }
+
+    // Prints the time ratio against a previous run; returns the number of regressions.
+    size_t compare_with_baseline(const std::vector<Result>& results, const Options& options) {
+        std::ifstream file(options.baseline_path);
+        if (!file) {
+            throw std::runtime_error("Cannot open baseline " + options.baseline_path);
+        }
+        nlohmann::json baseline;
+        file >> baseline;
+
+        std::map<std::string, double> previous;
+        for (const auto& entry : baseline.at("benchmarks")) {
+            previous[entry.at("name").get<std::string>()] = entry.at("mean_ns").get<double>();
+        }
+
+        size_t regressions = 0;
+        std::cerr << "\nComparison with " << options.baseline_path << " (time ratio, >1 is slower)\n";
+        for (const auto& r : results) {
+            auto it = previous.find(r.name);
+            if (it == previous.end()) {
+                continue;
+            }
+            double ratio = r.mean_ns / it->second;
+            bool regressed = ratio > 1.0 + options.threshold;
+            regressions += regressed;
+            std::cerr << std::left << std::setw(40) << r.name << std::right << std::fixed << std::setprecision(3)
+                      << std::setw(8) << ratio << (regressed ? "  REGRESSION" : "") << "\n";
+        }
+        return regressions;
+    }
+
+    Options parse_options(int argc, char** argv) {
+        Options options;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument("Missing value for " + arg);
+                }
+                return argv[++i];
+            };
+
+            if (arg == "--warmup") options.warmup = std::stoul(value());
+            else if (arg == "--repetitions") options.repetitions = std::max<size_t>(1, std::stoul(value()));
+            else if (arg == "--filter") options.filter = value();
+            else if (arg == "--json") options.json_path = value();
+            else if (arg == "--baseline") options.baseline_path = value();
+            else if (arg == "--threshold") options.threshold = std::stod(value());
+            else if (arg == "--datasets") options.dataset_dir = value();
+            else throw std::invalid_argument("Unknown option " + arg);
+        }
+        return options;
+    }
+}
+
+int main(int argc, char** argv) {
+    try {
+        Options options = parse_options(argc, argv);
+        Harness harness(options);
+        std::default_random_engine generator(42);
+
+        bench_linear(harness, generator);
+        bench_activations(harness, generator);
+        bench_losses(harness, generator);
+        bench_data(harness, options);
+        bench_training(harness, options);
+
+        std::ofstream json(options.json_path);
+        json << std::setw(2) << to_json(harness.get_results()) << std::endl;
+        std::cerr << "\nResults written to " << options.json_path << "\n";
+
+        if (!options.baseline_path.empty() && compare_with_baseline(harness.get_results(), options) > 0) {
+            return 2;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
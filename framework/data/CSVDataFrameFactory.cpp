@@ -41,3 +41,55 @@ DataFrame CSVDataFrameFactory::create_dataframe(const std::string& f_path) const
     file.close();
     return df;
 }
+
+SparseDataFrame CSVDataFrameFactory::create_sparse_dataframe(const std::string& f_path) const {
+    std::ifstream file(f_path);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open file: " + f_path);
+    }
+
+    SparseDataFrame df;
+    std::string line;
+    bool is_header = true;
+    std::vector<uint32_t> indices;
+    std::vector<long double> values;
+
+    while (std::getline(file, line)) {
+        std::stringstream ss(line);
+        std::string token;
+
+        if (is_header) {
+            std::vector<std::string> tokens;
+            while (std::getline(ss, token, ',')) {
+                tokens.push_back(token);
+            }
+            df.set_columns(tokens);
+            is_header = false;
+            continue;
+        }
+
+        indices.clear();
+        values.clear();
+        uint32_t column = 0;
+        while (std::getline(ss, token, ',')) {
+            long double value;
+            try {
+                value = std::stold(token);
+            } catch (const std::exception& e) {
+                throw std::invalid_argument("Non-numeric value found in data row");
+            }
+            if (value != 0.0L) {
+                indices.push_back(column);
+                values.push_back(value);
+            }
+            ++column;
+        }
+        if (column != df.column_count()) {
+            throw std::invalid_argument("Row size does not match column count");
+        }
+        df.append_row(SparseRow{indices.data(), values.data(), values.size(), column});
+    }
+
+    file.close();
+    return df;
+}
@@ -3,6 +3,7 @@
 
 #include "DataFrameFactory.h"
 #include "DataFrame.h"
+#include "SparseDataFrame.h"
 #include <string>
 
 /**
@@ -19,6 +20,15 @@ public:
      * @throws std::invalid_argument if non-numeric values are found in the data rows.
      */
     DataFrame create_dataframe(const std::string& f_path) const override;
+
+    /**
+     * @brief Parses a CSV file straight into a SparseDataFrame, never holding dense rows.
+     * @param f_path Path to the CSV file.
+     * @return A SparseDataFrame object with the non-zero data from the CSV file.
+     * @throws std::runtime_error if the file cannot be opened.
+     * @throws std::invalid_argument if non-numeric values are found in the data rows.
+     */
+    SparseDataFrame create_sparse_dataframe(const std::string& f_path) const;
 };
 
 #endif // CSVDATAFRAMEFACTORY_H
@@ -2,6 +2,61 @@
 #include "CSVDataFrameFactory.h"
 #include "JsonDataFrameFactory.h"
 #include <stdexcept>
+#include <algorithm>
+#include <ctime>
+#include <map>
+#include <random>
+
+namespace {
+    std::vector<size_t> shuffled_indices(size_t total_rows) {
+        std::vector<size_t> indices(total_rows);
+        for (size_t i = 0; i < total_rows; ++i) {
+            indices[i] = i;
+        }
+
+        std::srand(static_cast<unsigned>(time(0)));
+        std::random_shuffle(indices.begin(), indices.end());
+        return indices;
+    }
+
+    void check_test_ratio(float test_ratio) {
+        if (test_ratio < 0.0f || test_ratio > 1.0f) {
+            throw std::invalid_argument("test_ratio must be between 0 and 1.");
+        }
+    }
+
+    // Puts the first (1 - test_ratio) of the shuffled rows into the training set.
+    std::tuple<DataFrame, DataFrame, DataFrame, DataFrame>
+    split_rows(const DataFrame& data, const DataFrame& target, float test_ratio, const std::vector<size_t>& indices) {
+        size_t total_rows = data.row_count();
+        size_t test_size = static_cast<size_t>(total_rows * test_ratio);
+        size_t train_size = total_rows - test_size;
+
+        DataFrame train_data, test_data, train_target, test_target;
+        train_data.set_columns(data.get_columns());
+        test_data.set_columns(data.get_columns());
+        train_target.set_columns(target.get_columns());
+        test_target.set_columns(target.get_columns());
+
+        for (size_t i = 0; i < total_rows; ++i) {
+            if (i < train_size) {
+                train_data.append_row(data.get_data()[indices[i]]);
+                train_target.append_row(target.get_data()[indices[i]]);
+            } else {
+                test_data.append_row(data.get_data()[indices[i]]);
+                test_target.append_row(target.get_data()[indices[i]]);
+            }
+        }
+
+        return {train_data, test_data, train_target, test_target};
+    }
+
+    void check_folds(size_t row_count, size_t k) {
+        if (k < 2 || k > row_count) {
+            throw std::invalid_argument("k must be at least 2 and at most the number of rows.");
+        }
+    }
+}
 
 DataFrame DataFrameUtils::df_from_csv(const std::string& f_path) {
     CSVDataFrameFactory csvFactory;
@@ -13,25 +68,41 @@ DataFrame DataFrameUtils::df_from_json(const std::string& f_path) {
     return jsonFactory.create_dataframe(f_path);
 }
 
+SparseDataFrame DataFrameUtils::sparse_df_from_csv(const std::string& f_path) {
+    CSVDataFrameFactory csvFactory;
+    return csvFactory.create_sparse_dataframe(f_path);
+}
+
 std::tuple<DataFrame, DataFrame, DataFrame, DataFrame>
 DataFrameUtils::train_test_split(const DataFrame& data, const DataFrame& target, float test_ratio) {
-    if (test_ratio < 0.0f || test_ratio > 1.0f) {
-        throw std::invalid_argument("test_ratio must be between 0 and 1.");
+    check_test_ratio(test_ratio);
+    return split_rows(data, target, test_ratio, shuffled_indices(data.row_count()));
+}
+
+std::tuple<DataFrame, DataFrame, DataFrame, DataFrame>
+DataFrameUtils::train_test_split(const DataFrame& data, const DataFrame& target, float test_ratio, uint32_t seed) {
+    check_test_ratio(test_ratio);
+
+    std::vector<size_t> indices(data.row_count());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        indices[i] = i;
     }
+    std::shuffle(indices.begin(), indices.end(), std::mt19937(seed));
+    return split_rows(data, target, test_ratio, indices);
+}
+
+std::tuple<SparseDataFrame, SparseDataFrame, DataFrame, DataFrame>
+DataFrameUtils::train_test_split(const SparseDataFrame& data, const DataFrame& target, float test_ratio) {
+    check_test_ratio(test_ratio);
 
     size_t total_rows = data.row_count();
     size_t test_size = static_cast<size_t>(total_rows * test_ratio);
     size_t train_size = total_rows - test_size;
 
-    std::vector<size_t> indices(total_rows);
-    for (size_t i = 0; i < total_rows; ++i) {
-        indices[i] = i;
-    }
+    std::vector<size_t> indices = shuffled_indices(total_rows);
 
-    std::srand(static_cast<unsigned>(time(0)));
-    std::random_shuffle(indices.begin(), indices.end());
-
-    DataFrame train_data, test_data, train_target, test_target;
+    SparseDataFrame train_data, test_data;
+    DataFrame train_target, test_target;
     train_data.set_columns(data.get_columns());
     test_data.set_columns(data.get_columns());
     train_target.set_columns(target.get_columns());
@@ -39,13 +110,74 @@ DataFrameUtils::train_test_split(const DataFrame& data, const DataFrame& target,
 
     for (size_t i = 0; i < total_rows; ++i) {
         if (i < train_size) {
-            train_data.append_row(data.get_data()[indices[i]]);
+            train_data.append_row(data.get_row(indices[i]));
             train_target.append_row(target.get_data()[indices[i]]);
         } else {
-            test_data.append_row(data.get_data()[indices[i]]);
+            test_data.append_row(data.get_row(indices[i]));
             test_target.append_row(target.get_data()[indices[i]]);
         }
     }
 
     return {train_data, test_data, train_target, test_target};
 }
+
+DataFrame DataFrameUtils::shard(const DataFrame& data, size_t rank, size_t world_size) {
+    if (world_size == 0 || rank >= world_size) {
+        throw std::invalid_argument("Rank must be smaller than the world size.");
+    }
+
+    DataFrame shard;
+    shard.set_columns(data.get_columns());
+    size_t rows_per_rank = data.row_count() / world_size;
+    for (size_t i = 0; i < rows_per_rank; ++i) {
+        shard.append_row(data.get_data()[rank + i * world_size]);
+    }
+    return shard;
+}
+
+std::vector<std::vector<size_t>> DataFrameUtils::k_fold(size_t row_count, size_t k, uint32_t seed) {
+    check_folds(row_count, k);
+
+    std::vector<size_t> indices(row_count);
+    for (size_t i = 0; i < row_count; ++i) {
+        indices[i] = i;
+    }
+    std::shuffle(indices.begin(), indices.end(), std::mt19937(seed));
+
+    std::vector<std::vector<size_t>> folds(k);
+    for (size_t i = 0; i < row_count; ++i) {
+        folds[i % k].push_back(indices[i]);
+    }
+    return folds;
+}
+
+std::vector<std::vector<size_t>> DataFrameUtils::stratified_k_fold(const DataFrame& target, size_t k, uint32_t seed) {
+    check_folds(target.row_count(), k);
+
+    std::map<long double, std::vector<size_t>> classes;
+    const auto& rows = target.get_data();
+    for (size_t i = 0; i < rows.size(); ++i) {
+        const auto& row = rows[i];
+        long double label = row.size() == 1
+            ? row[0]
+            : static_cast<long double>(std::max_element(row.begin(), row.end()) - row.begin());
+        classes[label].push_back(i);
+    }
+
+    // Dealing continues across classes, so fold sizes also differ by at most one row.
+    std::mt19937 generator(seed);
+    std::vector<std::vector<size_t>> folds(k);
+    size_t next = 0;
+    for (auto& [label, members] : classes) {
+        std::shuffle(members.begin(), members.end(), generator);
+        for (size_t row : members) {
+            folds[next++ % k].push_back(row);
+        }
+    }
+
+    // Interleave the classes inside each fold, so training does not see one class at a time.
+    for (auto& fold : folds) {
+        std::shuffle(fold.begin(), fold.end(), generator);
+    }
+    return folds;
+}
@@ -2,7 +2,10 @@
 #define DATAFRAME_UTILS_H
 
 #include "DataFrame.h"
+#include "SparseDataFrame.h"
+#include <cstdint>
 #include <tuple>
+#include <vector>
 
 /**
  * @class DataFrameUtils
@@ -24,6 +27,13 @@ public:
      */
     static DataFrame df_from_json(const std::string& f_path);
 
+    /**
+     * @brief Creates a SparseDataFrame from a CSV file.
+     * @param f_path File path of the CSV.
+     * @return A SparseDataFrame loaded from the CSV file.
+     */
+    static SparseDataFrame sparse_df_from_csv(const std::string& f_path);
+
     /**
      * @brief Splits data and target into training and testing datasets.
      * @param data The input data.
@@ -33,6 +43,66 @@ public:
      */
     static std::tuple<DataFrame, DataFrame, DataFrame, DataFrame>
     train_test_split(const DataFrame& data, const DataFrame& target, float test_ratio);
+
+    /**
+     * @brief Splits data and target into training and testing datasets, repeatably.
+     * The same seed gives the same split in every process, e.g. on every rank of a
+     * distributed job.
+     * @param data The input data.
+     * @param target The target data.
+     * @param test_ratio Ratio of data to be used for testing.
+     * @param seed Seed of the shuffle.
+     * @return A tuple containing training data, testing data, training target, and testing target.
+     */
+    static std::tuple<DataFrame, DataFrame, DataFrame, DataFrame>
+    train_test_split(const DataFrame& data, const DataFrame& target, float test_ratio, uint32_t seed);
+
+    /**
+     * @brief Splits sparse data and its target into training and testing datasets.
+     * @param data The sparse input data.
+     * @param target The target data.
+     * @param test_ratio Ratio of data to be used for testing.
+     * @return A tuple containing training data, testing data, training target, and testing target.
+     */
+    static std::tuple<SparseDataFrame, SparseDataFrame, DataFrame, DataFrame>
+    train_test_split(const SparseDataFrame& data, const DataFrame& target, float test_ratio);
+
+    /**
+     * @brief Selects one rank's shard of the rows for data-parallel training.
+     * Rank r receives rows r, r + world_size, r + 2 * world_size, ... Every shard has
+     * row_count / world_size rows, so all ranks run the same number of steps; up to
+     * world_size - 1 trailing rows are left out. Apply it to data and target alike.
+     * @param data The full DataFrame, identical on every rank.
+     * @param rank This process's rank.
+     * @param world_size Number of ranks.
+     * @return The rows of this rank.
+     * @throws std::invalid_argument if rank is not smaller than world_size.
+     */
+    static DataFrame shard(const DataFrame& data, size_t rank, size_t world_size);
+
+    /**
+     * @brief Assigns shuffled rows to k folds for cross-validation.
+     * Fold sizes differ by at most one row.
+     * @param row_count Number of rows.
+     * @param k Number of folds.
+     * @param seed Seed of the shuffle, for repeatable folds.
+     * @return The row indices of every fold.
+     * @throws std::invalid_argument if k is smaller than 2 or larger than row_count.
+     */
+    static std::vector<std::vector<size_t>> k_fold(size_t row_count, size_t k, uint32_t seed = 42);
+
+    /**
+     * @brief Assigns rows to k folds keeping the class proportions of the target in every fold.
+     * Rows with the same single-column target value, or the same largest column for
+     * multi-column (one-hot) targets, form a class; each class is shuffled and dealt over
+     * the folds in turn.
+     * @param target The target DataFrame.
+     * @param k Number of folds.
+     * @param seed Seed of the shuffle, for repeatable folds.
+     * @return The row indices of every fold.
+     * @throws std::invalid_argument if k is smaller than 2 or larger than the number of rows.
+     */
+    static std::vector<std::vector<size_t>> stratified_k_fold(const DataFrame& target, size_t k, uint32_t seed = 42);
 };
 
 #endif // DATAFRAME_UTILS_H
@@ -0,0 +1,32 @@
+#include "DataFrameView.h"
+#include "DataFrameViewIterator.h"
+#include <stdexcept>
+
+DataFrameView::DataFrameView(const DataFrame& dataframe, std::vector<size_t> rows)
+    : dataframe(dataframe), rows(std::move(rows)) {
+    for (size_t row : this->rows) {
+        if (row >= dataframe.row_count()) {
+            throw std::out_of_range("View row index is out of range.");
+        }
+    }
+}
+
+const std::vector<long double>& DataFrameView::get_row(size_t index) const {
+    return dataframe.get_data()[rows[index]];
+}
+
+const std::vector<size_t>& DataFrameView::get_rows() const {
+    return rows;
+}
+
+size_t DataFrameView::row_count() const {
+    return rows.size();
+}
+
+size_t DataFrameView::column_count() const {
+    return dataframe.column_count();
+}
+
+std::unique_ptr<Iterator> DataFrameView::create_iterator() const {
+    return std::make_unique<DataFrameViewIterator>(*this);
+}
@@ -0,0 +1,62 @@
+#ifndef DATAFRAME_VIEW_H
+#define DATAFRAME_VIEW_H
+
+#include <vector>
+#include <memory>
+#include "IterableCollection.h"
+#include "Iterator.h"
+#include "DataFrame.h"
+
+/**
+ * @class DataFrameView
+ * @brief A selection of rows of a DataFrame, in any order, without copying them.
+ * Implements IterableCollection.
+ *
+ * The view keeps a reference to the DataFrame and a list of row indices, so many views
+ * (e.g. the folds of a cross-validation) can share one DataFrame from several threads.
+ * The DataFrame must outlive the view and not be modified while it is in use.
+ */
+class DataFrameView : public IterableCollection {
+private:
+    const DataFrame& dataframe;
+    std::vector<size_t> rows;
+
+public:
+    /**
+     * @brief Constructor for DataFrameView.
+     * @param dataframe The DataFrame to select from.
+     * @param rows Indices of the selected rows, in iteration order.
+     * @throws std::out_of_range if an index is not a row of the DataFrame.
+     */
+    DataFrameView(const DataFrame& dataframe, std::vector<size_t> rows);
+
+    /**
+     * @brief Returns the i-th selected row.
+     * @param index Position inside the view.
+     * @return A reference to the row in the DataFrame.
+     */
+    const std::vector<long double>& get_row(size_t index) const;
+
+    /**
+     * @brief Returns the indices of the selected rows in the DataFrame.
+     */
+    const std::vector<size_t>& get_rows() const;
+
+    /**
+     * @brief Returns the number of selected rows.
+     */
+    size_t row_count() const;
+
+    /**
+     * @brief Returns the number of columns of the DataFrame.
+     */
+    size_t column_count() const;
+
+    /**
+     * @brief Creates an iterator over the selected rows.
+     * @return A unique pointer to the iterator.
+     */
+    std::unique_ptr<Iterator> create_iterator() const override;
+};
+
+#endif // DATAFRAME_VIEW_H
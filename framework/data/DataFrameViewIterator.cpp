@@ -0,0 +1,23 @@
+#include "DataFrameViewIterator.h"
+
+DataFrameViewIterator::DataFrameViewIterator(const DataFrameView& view)
+    : view(view), currentRowIndex(0) {}
+
+bool DataFrameViewIterator::has_more() const {
+    return currentRowIndex < view.row_count();
+}
+
+const std::vector<long double>& DataFrameViewIterator::get_next() {
+    if (!has_more()) {
+        throw std::out_of_range("No more rows in the DataFrameView.");
+    }
+    return view.get_row(currentRowIndex++);
+}
+
+void DataFrameViewIterator::reset() {
+    currentRowIndex = 0;
+}
+
+size_t DataFrameViewIterator::size() const {
+    return view.row_count();
+}
@@ -0,0 +1,47 @@
+#ifndef DATAFRAME_VIEW_ITERATOR_H
+#define DATAFRAME_VIEW_ITERATOR_H
+
+#include "Iterator.h"
+#include "DataFrameView.h"
+
+/**
+ * @class DataFrameViewIterator
+ * @brief Concrete iterator for iterating the rows selected by a DataFrameView.
+ */
+class DataFrameViewIterator : public Iterator {
+public:
+    /**
+     * @brief Constructor for DataFrameViewIterator.
+     * @param view Reference to the view to iterate.
+     */
+    DataFrameViewIterator(const DataFrameView& view);
+
+    /**
+     * @brief Checks if there are more rows to be iterated in the view.
+     * @return True if there are more rows in the view, false otherwise.
+     */
+    bool has_more() const override;
+
+    /**
+     * @brief Returns the next row.
+     * @return A reference to the next row.
+     * @throws std::out_of_range if no more rows are available.
+     */
+    const std::vector<long double>& get_next() override;
+
+    /**
+     * @brief Resets the iterator to the first row.
+     */
+    void reset() override;
+
+    /**
+     * @brief Returns how many rows there are in the view.
+     */
+    size_t size() const override;
+
+private:
+    const DataFrameView& view;
+    size_t currentRowIndex;
+};
+
+#endif // DATAFRAME_VIEW_ITERATOR_H
@@ -0,0 +1,133 @@
+#include "SparseDataFrame.h"
+#include "SparseDataFrameIterator.h"
+#include <algorithm>
+#include <stdexcept>
+
+SparseDataFrame SparseDataFrame::from_dense(const DataFrame& dataframe) {
+    SparseDataFrame sparse;
+    sparse.set_columns(dataframe.get_columns());
+    for (const auto& row : dataframe.get_data()) {
+        sparse.append_row(row);
+    }
+    return sparse;
+}
+
+void SparseDataFrame::set_columns(const std::vector<std::string>& names) {
+    column_names = names;
+}
+
+void SparseDataFrame::append_row(const std::vector<long double>& row) {
+    if (row.size() != column_names.size()) {
+        throw std::invalid_argument("Row size does not match column count");
+    }
+
+    for (size_t j = 0; j < row.size(); ++j) {
+        if (row[j] != 0.0L) {
+            column_indices.push_back(static_cast<uint32_t>(j));
+            values.push_back(row[j]);
+        }
+    }
+    row_offsets.push_back(values.size());
+}
+
+void SparseDataFrame::append_row(const SparseRow& row) {
+    for (size_t k = 0; k < row.size; ++k) {
+        if (row.indices[k] >= column_names.size() || (k > 0 && row.indices[k] <= row.indices[k - 1])) {
+            throw std::invalid_argument("Sparse row indices must be increasing and within the column count");
+        }
+    }
+
+    column_indices.insert(column_indices.end(), row.indices, row.indices + row.size);
+    values.insert(values.end(), row.values, row.values + row.size);
+    row_offsets.push_back(values.size());
+}
+
+const std::vector<std::string>& SparseDataFrame::get_columns() const {
+    return column_names;
+}
+
+SparseRow SparseDataFrame::get_row(size_t index) const {
+    if (index >= row_count()) {
+        throw std::out_of_range("Row index out of range.");
+    }
+
+    size_t begin = row_offsets[index];
+    return {column_indices.data() + begin, values.data() + begin, row_offsets[index + 1] - begin, column_names.size()};
+}
+
+size_t SparseDataFrame::row_count() const {
+    return row_offsets.size() - 1;
+}
+
+size_t SparseDataFrame::column_count() const {
+    return column_names.size();
+}
+
+size_t SparseDataFrame::non_zero_count() const {
+    return values.size();
+}
+
+std::unique_ptr<DataFrame> SparseDataFrame::dataframe_from_column(const std::string& column) const {
+    auto it = std::find(column_names.begin(), column_names.end(), column);
+    if (it == column_names.end()) {
+        throw std::invalid_argument("Column '" + column + "' does not exist.");
+    }
+
+    uint32_t index = static_cast<uint32_t>(std::distance(column_names.begin(), it));
+
+    auto result = std::make_unique<DataFrame>();
+    result->set_columns({column});
+
+    for (size_t r = 0; r < row_count(); ++r) {
+        auto begin = column_indices.begin() + row_offsets[r];
+        auto end = column_indices.begin() + row_offsets[r + 1];
+        auto found = std::lower_bound(begin, end, index);
+        long double value = (found != end && *found == index) ? values[found - column_indices.begin()] : 0.0L;
+        result->append_row({value});
+    }
+
+    return result;
+}
+
+void SparseDataFrame::drop_columns(const std::vector<std::string>& columns) {
+    std::vector<bool> dropped(column_names.size(), false);
+    for (const auto& col_name : columns) {
+        auto it = std::find(column_names.begin(), column_names.end(), col_name);
+        if (it == column_names.end()) {
+            throw std::invalid_argument("Column '" + col_name + "' does not exist.");
+        }
+        dropped[std::distance(column_names.begin(), it)] = true;
+    }
+
+    // old column index -> new column index
+    std::vector<uint32_t> remap(column_names.size());
+    std::vector<std::string> kept_names;
+    for (size_t j = 0; j < column_names.size(); ++j) {
+        remap[j] = static_cast<uint32_t>(kept_names.size());
+        if (!dropped[j]) {
+            kept_names.push_back(column_names[j]);
+        }
+    }
+
+    size_t write = 0;
+    for (size_t r = 0; r < row_count(); ++r) {
+        size_t begin = row_offsets[r];
+        size_t end = row_offsets[r + 1];
+        row_offsets[r] = write;
+        for (size_t k = begin; k < end; ++k) {
+            if (!dropped[column_indices[k]]) {
+                column_indices[write] = remap[column_indices[k]];
+                values[write] = values[k];
+                ++write;
+            }
+        }
+    }
+    row_offsets.back() = write;
+    column_indices.resize(write);
+    values.resize(write);
+    column_names = kept_names;
+}
+
+std::unique_ptr<SparseIterator> SparseDataFrame::create_iterator() const {
+    return std::make_unique<SparseDataFrameIterator>(*this);
+}
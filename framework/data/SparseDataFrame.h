@@ -0,0 +1,110 @@
+#ifndef SPARSE_DATAFRAME_H
+#define SPARSE_DATAFRAME_H
+
+#include "DataFrame.h"
+#include "SparseRow.h"
+#include "SparseIterator.h"
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+
+/**
+ * @class SparseDataFrame
+ * @brief Tabular data stored in compressed sparse row (CSR) format.
+ *
+ * Only non-zero values are kept, together with their 32-bit column index. Suited for
+ * one-hot and hashed feature columns, where most entries of a row are zero.
+ */
+class SparseDataFrame {
+private:
+    std::vector<std::string> column_names;
+    std::vector<size_t> row_offsets{0};
+    std::vector<uint32_t> column_indices;
+    std::vector<long double> values;
+
+public:
+    /**
+     * @brief Default constructor for SparseDataFrame.
+     */
+    SparseDataFrame() = default;
+
+    /**
+     * @brief Converts a dense DataFrame, dropping its zero entries.
+     * @param dataframe The dense DataFrame.
+     * @return The sparse equivalent.
+     */
+    static SparseDataFrame from_dense(const DataFrame& dataframe);
+
+    /**
+     * @brief Sets the column names of the SparseDataFrame.
+     * @param names A vector of strings representing column names.
+     */
+    void set_columns(const std::vector<std::string>& names);
+
+    /**
+     * @brief Adds a dense row, storing only its non-zero entries.
+     * @param row A vector of long doubles representing a row of data.
+     * @throws std::invalid_argument if the row size does not match the column count.
+     */
+    void append_row(const std::vector<long double>& row);
+
+    /**
+     * @brief Adds a row given by its non-zero entries.
+     * @param row The row to copy; indices must be increasing and below the column count.
+     * @throws std::invalid_argument if an index is out of range or not increasing.
+     */
+    void append_row(const SparseRow& row);
+
+    /**
+     * @brief Returns the column names of the SparseDataFrame.
+     * @return A vector of strings representing column names.
+     */
+    const std::vector<std::string>& get_columns() const;
+
+    /**
+     * @brief Returns a view of one row.
+     * @param index The row index.
+     * @return The row's non-zero entries.
+     * @throws std::out_of_range if the index is out of range.
+     */
+    SparseRow get_row(size_t index) const;
+
+    /**
+     * @brief Returns the number of rows in the SparseDataFrame.
+     */
+    size_t row_count() const;
+
+    /**
+     * @brief Returns the number of columns in the SparseDataFrame.
+     */
+    size_t column_count() const;
+
+    /**
+     * @brief Returns the number of stored (non-zero) entries.
+     */
+    size_t non_zero_count() const;
+
+    /**
+     * @brief Creates a dense DataFrame from a column.
+     * @param column The name of the column.
+     * @return A unique pointer to a new DataFrame containing only the selected column.
+     * @throws std::invalid_argument if the column does not exist.
+     */
+    std::unique_ptr<DataFrame> dataframe_from_column(const std::string& column) const;
+
+    /**
+     * @brief Drops one or more columns from the SparseDataFrame.
+     * @param columns A vector of column names to drop.
+     * @throws std::invalid_argument if any column does not exist.
+     */
+    void drop_columns(const std::vector<std::string>& columns);
+
+    /**
+     * @brief Creates an iterator over the sparse rows.
+     * @return A unique pointer to a SparseDataFrameIterator.
+     */
+    std::unique_ptr<SparseIterator> create_iterator() const;
+};
+
+#endif // SPARSE_DATAFRAME_H
@@ -0,0 +1,24 @@
+#include "SparseDataFrameIterator.h"
+#include <stdexcept>
+
+SparseDataFrameIterator::SparseDataFrameIterator(const SparseDataFrame& dataframe)
+    : dataframe(dataframe), currentRowIndex(0) {}
+
+bool SparseDataFrameIterator::has_more() const {
+    return currentRowIndex < dataframe.row_count();
+}
+
+SparseRow SparseDataFrameIterator::get_next() {
+    if (!has_more()) {
+        throw std::out_of_range("No more rows in the SparseDataFrame.");
+    }
+    return dataframe.get_row(currentRowIndex++);
+}
+
+void SparseDataFrameIterator::reset() {
+    currentRowIndex = 0;
+}
+
+size_t SparseDataFrameIterator::size() const {
+    return dataframe.row_count();
+}
@@ -0,0 +1,47 @@
+#ifndef SPARSE_DATAFRAME_ITERATOR_H
+#define SPARSE_DATAFRAME_ITERATOR_H
+
+#include "SparseIterator.h"
+#include "SparseDataFrame.h"
+
+/**
+ * @class SparseDataFrameIterator
+ * @brief Concrete iterator for iterating rows of a SparseDataFrame.
+ */
+class SparseDataFrameIterator : public SparseIterator {
+public:
+    /**
+     * @brief Constructor for SparseDataFrameIterator.
+     * @param dataframe Reference to the SparseDataFrame to iterate.
+     */
+    SparseDataFrameIterator(const SparseDataFrame& dataframe);
+
+    /**
+     * @brief Checks if there are more rows to be iterated in the SparseDataFrame.
+     * @return True if there are more rows, false otherwise.
+     */
+    bool has_more() const override;
+
+    /**
+     * @brief Returns the next row.
+     * @return A view of the next row.
+     * @throws std::out_of_range if no more rows are available.
+     */
+    SparseRow get_next() override;
+
+    /**
+     * @brief Resets the iterator to the first row.
+     */
+    void reset() override;
+
+    /**
+     * @brief Returns how many rows there are in the SparseDataFrame.
+     */
+    size_t size() const override;
+
+private:
+    const SparseDataFrame& dataframe;
+    size_t currentRowIndex;
+};
+
+#endif // SPARSE_DATAFRAME_ITERATOR_H
@@ -0,0 +1,43 @@
+#ifndef SPARSE_ITERATOR_H
+#define SPARSE_ITERATOR_H
+
+#include "SparseRow.h"
+#include <cstddef>
+
+/**
+ * @interface SparseIterator
+ * @brief Interface for iterators over sparse rows.
+ */
+class SparseIterator {
+public:
+    /**
+     * @brief Checks if there are more rows to be iterated.
+     * @return True if there are more rows, false otherwise.
+     */
+    virtual bool has_more() const = 0;
+
+    /**
+     * @brief Returns the next row.
+     * @return A view of the next row, valid while the collection is alive and unchanged.
+     * @throws std::out_of_range if no more rows are available.
+     */
+    virtual SparseRow get_next() = 0;
+
+    /**
+     * @brief Resets the iterator to the first row of the collection.
+     */
+    virtual void reset() = 0;
+
+    /**
+     * @brief Returns the number of rows in the collection.
+     * @return Number of rows as a size_t.
+     */
+    virtual size_t size() const = 0;
+
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~SparseIterator() = default;
+};
+
+#endif // SPARSE_ITERATOR_H
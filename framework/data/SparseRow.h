@@ -0,0 +1,18 @@
+#ifndef SPARSE_ROW_H
+#define SPARSE_ROW_H
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @struct SparseRow
+ * @brief Non-owning view of one sparse row: the non-zero values and their column indices.
+ */
+struct SparseRow {
+    const uint32_t* indices = nullptr;
+    const long double* values = nullptr;
+    size_t size = 0;        ///< Number of non-zero entries.
+    size_t dimension = 0;   ///< Number of columns of the dense row.
+};
+
+#endif // SPARSE_ROW_H
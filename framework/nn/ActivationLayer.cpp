@@ -3,13 +3,34 @@
 ActivationLayer::ActivationLayer(
     std::function<std::vector<long double>(const std::vector<long double>&)> func,
     std::function<std::vector<long double>(const std::vector<long double>&)> derivative)
-    : activation_func(std::move(func)), activation_derivative(std::move(derivative)) {}
+    : activation_func(std::move(func)), activation_derivative(std::move(derivative)),
+      activation_kind(ActivationKind::Custom) {
+    using ActivationFn = std::vector<long double> (*)(const std::vector<long double>&);
+
+    const auto* target = activation_func.target<ActivationFn>();
+    if (target == nullptr) {
+        return;
+    }
+    if (*target == &Activations::identity) {
+        activation_kind = ActivationKind::Identity;
+    } else if (*target == &Activations::relu) {
+        activation_kind = ActivationKind::ReLU;
+    } else if (*target == &Activations::sigmoid) {
+        activation_kind = ActivationKind::Sigmoid;
+    } else if (*target == &Activations::tanh) {
+        activation_kind = ActivationKind::Tanh;
+    }
+}
 
 std::vector<long double> ActivationLayer::forward(const std::vector<long double>& inputs) {
     inputs_cache = inputs;
     return activation_func(inputs);
 }
 
+std::vector<long double> ActivationLayer::predict(const std::vector<long double>& inputs) const {
+    return activation_func(inputs);
+}
+
 std::vector<long double> ActivationLayer::backward(const std::vector<long double>& gradients) {
     auto derivatives = activation_derivative(inputs_cache);
     std::vector<long double> input_gradients(gradients.size());
@@ -20,3 +41,15 @@ std::vector<long double> ActivationLayer::backward(const std::vector<long double
 
     return input_gradients;
 }
+
+void ActivationLayer::release_cache() {
+    std::vector<long double>().swap(inputs_cache);
+}
+
+std::shared_ptr<Module> ActivationLayer::clone() const {
+    return std::make_shared<ActivationLayer>(*this);
+}
+
+ActivationKind ActivationLayer::kind() const {
+    return activation_kind;
+}
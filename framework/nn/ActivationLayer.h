@@ -2,6 +2,7 @@
 #define ACTIVATIONLAYER_H
 
 #include "Module.h"
+#include "Activations.h"
 #include <vector>
 #include <functional>
 
@@ -14,6 +15,7 @@ private:
     std::function<std::vector<long double>(const std::vector<long double>&)> activation_func;
     std::function<std::vector<long double>(const std::vector<long double>&)> activation_derivative;
     std::vector<long double> inputs_cache;
+    ActivationKind activation_kind;
 
 public:
     /**
@@ -32,6 +34,13 @@ public:
      */
     std::vector<long double> forward(const std::vector<long double>& inputs) override;
 
+    /**
+     * @brief Performs the forward pass without caching inputs.
+     * @param inputs The input tensor.
+     * @return The output tensor.
+     */
+    std::vector<long double> predict(const std::vector<long double>& inputs) const override;
+
     /**
      * @brief Performs the backward pass.
      * @param gradients The gradient of the loss with respect to the output.
@@ -39,11 +48,28 @@ public:
      */
     std::vector<long double> backward(const std::vector<long double>& gradients) override;
 
+    /**
+     * @brief Frees the cached inputs.
+     */
+    void release_cache() override;
+
     /**
      * @brief Updates parameters (does nothing for ActivationLayer).
      * @param learning_rate The learning rate for gradient descent.
      */
     void update_parameters(long double learning_rate) override {}
+
+    /**
+     * @brief Creates an independent copy of the layer.
+     * @return The copy.
+     */
+    std::shared_ptr<Module> clone() const override;
+
+    /**
+     * @brief Returns which built-in activation this layer applies.
+     * @return The activation kind, or ActivationKind::Custom for user supplied functions.
+     */
+    ActivationKind kind() const;
 };
 
 #endif // ACTIVATIONLAYER_H
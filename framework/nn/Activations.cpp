@@ -1,6 +1,14 @@
 #include "Activations.h"
 #include <algorithm>
 
+std::vector<long double> Activations::identity(const std::vector<long double>& inputs) {
+    return inputs;
+}
+
+std::vector<long double> Activations::identity_derivative(const std::vector<long double>& inputs) {
+    return std::vector<long double>(inputs.size(), 1.0L);
+}
+
 std::vector<long double> Activations::relu(const std::vector<long double>& inputs) {
     std::vector<long double> outputs(inputs.size());
     for (size_t i = 0; i < inputs.size(); ++i) {
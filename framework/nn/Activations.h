@@ -5,11 +5,26 @@
 #include <cmath>
 #include <functional>
 
+/**
+ * @enum ActivationKind
+ * @brief Identifies the built-in activation functions, used by kernels that fuse them.
+ */
+enum class ActivationKind {
+    Custom,
+    Identity,
+    ReLU,
+    Sigmoid,
+    Tanh
+};
+
 /**
  * @namespace Activations
  * @brief Namespace containing common activation functions and their derivatives.
  */
 namespace Activations {
+    std::vector<long double> identity(const std::vector<long double>& inputs);
+    std::vector<long double> identity_derivative(const std::vector<long double>& inputs);
+
     std::vector<long double> relu(const std::vector<long double>& inputs);
     std::vector<long double> relu_derivative(const std::vector<long double>& inputs);
 
@@ -0,0 +1,76 @@
+#include "Adam.h"
+#include <cmath>
+#include <stdexcept>
+
+Adam::Adam(long double learning_rate, long double beta1, long double beta2, long double epsilon,
+           long double weight_decay, bool decoupled_weight_decay, size_t num_threads)
+    : Optimizer(num_threads), learning_rate(learning_rate), beta1(beta1), beta2(beta2),
+      epsilon(epsilon), weight_decay(weight_decay), decoupled_weight_decay(decoupled_weight_decay),
+      step_count(0) {}
+
+void Adam::step(ParameterView parameters, ParameterView gradients, long double gradient_scale) {
+    if (parameters.size != gradients.size) {
+        throw std::invalid_argument("Parameters and gradients must have the same size.");
+    }
+    if (first_moment.size() != parameters.size) {
+        first_moment.assign(parameters.size, 0.0L);
+        second_moment.assign(parameters.size, 0.0L);
+        step_count = 0;
+    }
+    ++step_count;
+
+    const long double step_size = learning_rate / (1.0L - std::pow(beta1, step_count));
+    const long double second_correction = 1.0L / (1.0L - std::pow(beta2, step_count));
+    const long double coupled_decay = decoupled_weight_decay ? 0.0L : weight_decay;
+    const long double parameter_decay = decoupled_weight_decay ? 1.0L - learning_rate * weight_decay : 1.0L;
+
+    long double* p = parameters.data;
+    long double* g = gradients.data;
+    long double* m = first_moment.data();
+    long double* v = second_moment.data();
+    const long double b1 = beta1;
+    const long double b2 = beta2;
+    const long double eps = epsilon;
+
+    parallel_for(parameters.size, [=](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            long double grad = gradient_scale * g[i] + coupled_decay * p[i];
+            m[i] = b1 * m[i] + (1.0L - b1) * grad;
+            v[i] = b2 * v[i] + (1.0L - b2) * grad * grad;
+            p[i] = parameter_decay * p[i] - step_size * m[i] / (std::sqrt(v[i] * second_correction) + eps);
+            g[i] = 0.0L;
+        }
+    });
+}
+
+void Adam::sparse_step(ParameterView table, size_t row_size, const std::vector<size_t>& rows,
+                       const long double* gradients, long double gradient_scale) {
+    // Both moments of a row side by side: [m_0..m_n, v_0..v_n].
+    SparseRowState& state = sparse_state(table, 2 * row_size);
+    const long double coupled_decay = decoupled_weight_decay ? 0.0L : weight_decay;
+    const long double parameter_decay = decoupled_weight_decay ? 1.0L - learning_rate * weight_decay : 1.0L;
+
+    for (size_t r = 0; r < rows.size(); ++r) {
+        if (row_size == 0 || (rows[r] + 1) * row_size > table.size) {
+            throw std::invalid_argument("Sparse row is outside the table.");
+        }
+        long double* p = table.data + rows[r] * row_size;
+        const long double* g = gradients + r * row_size;
+        long double* m = state.get(rows[r]);
+        long double* v = m + row_size;
+        size_t row_steps = ++state.step_count(rows[r]);
+
+        const long double step_size = learning_rate / (1.0L - std::pow(beta1, row_steps));
+        const long double second_correction = 1.0L / (1.0L - std::pow(beta2, row_steps));
+        for (size_t d = 0; d < row_size; ++d) {
+            long double grad = gradient_scale * g[d] + coupled_decay * p[d];
+            m[d] = beta1 * m[d] + (1.0L - beta1) * grad;
+            v[d] = beta2 * v[d] + (1.0L - beta2) * grad * grad;
+            p[d] = parameter_decay * p[d] - step_size * m[d] / (std::sqrt(v[d] * second_correction) + epsilon);
+        }
+    }
+}
+
+long double Adam::get_learning_rate() const {
+    return learning_rate;
+}
@@ -0,0 +1,85 @@
+#ifndef ADAM_H
+#define ADAM_H
+
+#include "Optimizer.h"
+#include <vector>
+
+/**
+ * @class Adam
+ * @brief Adam optimizer. With decoupled weight decay it behaves as AdamW.
+ */
+class Adam : public Optimizer {
+private:
+    long double learning_rate;
+    long double beta1;
+    long double beta2;
+    long double epsilon;
+    long double weight_decay;
+    bool decoupled_weight_decay;
+    size_t step_count;
+    std::vector<long double> first_moment;
+    std::vector<long double> second_moment;
+
+public:
+    /**
+     * @brief Constructor for Adam.
+     * @param learning_rate The learning rate.
+     * @param beta1 Decay rate of the first moment estimate.
+     * @param beta2 Decay rate of the second moment estimate.
+     * @param epsilon Term added to the denominator for numerical stability.
+     * @param weight_decay Weight decay factor.
+     * @param decoupled_weight_decay Apply weight decay to the parameters (AdamW) instead of the gradients.
+     * @param num_threads Number of threads used by a step.
+     */
+    explicit Adam(long double learning_rate = 0.001L, long double beta1 = 0.9L, long double beta2 = 0.999L,
+                  long double epsilon = 1e-8L, long double weight_decay = 0.0L,
+                  bool decoupled_weight_decay = false, size_t num_threads = 1);
+
+    /**
+     * @brief Applies one Adam update and resets the gradients.
+     * @param parameters The flat parameter buffer.
+     * @param gradients The matching flat gradient buffer.
+     * @param gradient_scale Factor applied to every gradient.
+     */
+    void step(ParameterView parameters, ParameterView gradients, long double gradient_scale = 1.0L) override;
+
+    /**
+     * @brief Applies the same update to some rows of an out-of-store table (lazy Adam).
+     * Each row has its own moments and step count for bias correction.
+     * @param table The whole table, row-major.
+     * @param row_size Scalars per row.
+     * @param rows Indices of the rows to update.
+     * @param gradients Gradients of those rows, rows.size() x row_size.
+     * @param gradient_scale Factor applied to every gradient.
+     */
+    void sparse_step(ParameterView table, size_t row_size, const std::vector<size_t>& rows,
+                     const long double* gradients, long double gradient_scale = 1.0L) override;
+
+    /**
+     * @brief Returns the learning rate.
+     */
+    long double get_learning_rate() const override;
+};
+
+/**
+ * @class AdamW
+ * @brief Adam with decoupled weight decay.
+ */
+class AdamW : public Adam {
+public:
+    /**
+     * @brief Constructor for AdamW.
+     * @param learning_rate The learning rate.
+     * @param weight_decay Decoupled weight decay factor.
+     * @param beta1 Decay rate of the first moment estimate.
+     * @param beta2 Decay rate of the second moment estimate.
+     * @param epsilon Term added to the denominator for numerical stability.
+     * @param num_threads Number of threads used by a step.
+     */
+    explicit AdamW(long double learning_rate = 0.001L, long double weight_decay = 0.01L,
+                   long double beta1 = 0.9L, long double beta2 = 0.999L, long double epsilon = 1e-8L,
+                   size_t num_threads = 1)
+        : Adam(learning_rate, beta1, beta2, epsilon, weight_decay, true, num_threads) {}
+};
+
+#endif // ADAM_H
@@ -0,0 +1,91 @@
+#include "AffineLayer.h"
+#include <cmath>
+#include <stdexcept>
+
+AffineLayer::AffineLayer(std::vector<long double> scale, std::vector<long double> shift)
+    : scale(std::move(scale)), shift(std::move(shift)) {
+    if (this->scale.size() != this->shift.size()) {
+        throw std::invalid_argument("Scale and shift must have the same size.");
+    }
+}
+
+std::shared_ptr<AffineLayer> AffineLayer::standardization(const DataFrame& data) {
+    if (data.row_count() == 0) {
+        throw std::invalid_argument("Cannot standardize an empty DataFrame.");
+    }
+
+    size_t columns = data.column_count();
+    long double rows = static_cast<long double>(data.row_count());
+    std::vector<long double> mean(columns, 0.0L);
+    std::vector<long double> variance(columns, 0.0L);
+
+    for (const auto& row : data.get_data()) {
+        for (size_t j = 0; j < columns; ++j) {
+            mean[j] += row[j];
+        }
+    }
+    for (size_t j = 0; j < columns; ++j) {
+        mean[j] /= rows;
+    }
+    for (const auto& row : data.get_data()) {
+        for (size_t j = 0; j < columns; ++j) {
+            long double d = row[j] - mean[j];
+            variance[j] += d * d;
+        }
+    }
+
+    std::vector<long double> scale(columns);
+    std::vector<long double> shift(columns);
+    for (size_t j = 0; j < columns; ++j) {
+        long double deviation = std::sqrt(variance[j] / rows);
+        scale[j] = deviation > 0.0L ? 1.0L / deviation : 1.0L;
+        shift[j] = -mean[j] * scale[j];
+    }
+
+    return std::make_shared<AffineLayer>(std::move(scale), std::move(shift));
+}
+
+std::vector<long double> AffineLayer::forward(const std::vector<long double>& inputs) {
+    return predict(inputs);
+}
+
+std::vector<long double> AffineLayer::predict(const std::vector<long double>& inputs) const {
+    if (inputs.size() != scale.size()) {
+        throw std::invalid_argument("Input size does not match the layer's size.");
+    }
+
+    std::vector<long double> outputs(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        outputs[i] = inputs[i] * scale[i] + shift[i];
+    }
+    return outputs;
+}
+
+std::vector<long double> AffineLayer::backward(const std::vector<long double>& gradients) {
+    std::vector<long double> input_gradients(gradients.size());
+    for (size_t i = 0; i < gradients.size(); ++i) {
+        input_gradients[i] = gradients[i] * scale[i];
+    }
+    return input_gradients;
+}
+
+std::shared_ptr<Module> AffineLayer::clone() const {
+    return std::make_shared<AffineLayer>(*this);
+}
+
+bool AffineLayer::is_identity() const {
+    for (size_t i = 0; i < scale.size(); ++i) {
+        if (scale[i] != 1.0L || shift[i] != 0.0L) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const std::vector<long double>& AffineLayer::get_scale() const {
+    return scale;
+}
+
+const std::vector<long double>& AffineLayer::get_shift() const {
+    return shift;
+}
@@ -0,0 +1,88 @@
+#ifndef AFFINELAYER_H
+#define AFFINELAYER_H
+
+#include "Module.h"
+#include "DataFrame.h"
+#include <vector>
+
+/**
+ * @class AffineLayer
+ * @brief Fixed element-wise transformation y = x * scale + shift, e.g. input standardization.
+ *
+ * The scale and shift are not trained; the layer only propagates gradients.
+ */
+class AffineLayer : public Module {
+private:
+    std::vector<long double> scale;
+    std::vector<long double> shift;
+
+public:
+    /**
+     * @brief Constructor for AffineLayer.
+     * @param scale Per-feature multiplier.
+     * @param shift Per-feature offset added after scaling.
+     * @throws std::invalid_argument if the vectors have different sizes.
+     */
+    AffineLayer(std::vector<long double> scale, std::vector<long double> shift);
+
+    /**
+     * @brief Builds a layer that standardizes every column to zero mean and unit variance.
+     * Constant columns are only centered.
+     * @param data The training data (without the target column).
+     * @return The standardization layer.
+     * @throws std::invalid_argument if the DataFrame is empty.
+     */
+    static std::shared_ptr<AffineLayer> standardization(const DataFrame& data);
+
+    /**
+     * @brief Performs the forward pass.
+     * @param inputs The input tensor.
+     * @return The transformed tensor.
+     * @throws std::invalid_argument if the input size does not match.
+     */
+    std::vector<long double> forward(const std::vector<long double>& inputs) override;
+
+    /**
+     * @brief Performs the forward pass.
+     * @param inputs The input tensor.
+     * @return The transformed tensor.
+     * @throws std::invalid_argument if the input size does not match.
+     */
+    std::vector<long double> predict(const std::vector<long double>& inputs) const override;
+
+    /**
+     * @brief Performs the backward pass.
+     * @param gradients The gradient of the loss with respect to the output.
+     * @return The gradient of the loss with respect to the input.
+     */
+    std::vector<long double> backward(const std::vector<long double>& gradients) override;
+
+    /**
+     * @brief Does nothing, the transformation is fixed.
+     * @param learning_rate Ignored.
+     */
+    void update_parameters(long double learning_rate) override {}
+
+    /**
+     * @brief Creates an independent copy of the layer.
+     * @return The copy.
+     */
+    std::shared_ptr<Module> clone() const override;
+
+    /**
+     * @brief Checks whether the layer leaves its input unchanged.
+     */
+    bool is_identity() const;
+
+    /**
+     * @brief Returns the per-feature multipliers.
+     */
+    const std::vector<long double>& get_scale() const;
+
+    /**
+     * @brief Returns the per-feature offsets.
+     */
+    const std::vector<long double>& get_shift() const;
+};
+
+#endif // AFFINELAYER_H
@@ -1,6 +1,11 @@
 #include "BCELoss.h"
 #include <stdexcept>
 #include <cmath>
+#include <algorithm>
+
+namespace {
+    constexpr long double EPSILON = 1e-15L;
+}
 
 long double BinaryCrossEntropyLoss::compute_loss(
     const std::vector<long double>& predictions,
@@ -10,11 +15,28 @@ long double BinaryCrossEntropyLoss::compute_loss(
         throw std::invalid_argument("Predictions and targets must have the same size.");
     }
 
-    long double loss = 0.0;
-    for (size_t i = 0; i < predictions.size(); ++i) {
-        long double p = std::max(std::min(predictions[i], 1.0L - 1e-15L), 1e-15L);
+    return compute_loss_and_gradient(predictions.data(), targets.data(), nullptr, 1, predictions.size());
+}
+
+long double BinaryCrossEntropyLoss::compute_loss_and_gradient(
+    const long double* predictions,
+    const long double* targets,
+    long double* gradients,
+    size_t batch_size,
+    size_t output_size
+) const {
+    const size_t count = batch_size * output_size;
+    const long double inverse_outputs = 1.0L / output_size;
+
+    long double loss = 0.0L;
+    for (size_t i = 0; i < count; ++i) {
         long double t = targets[i];
+        long double p = std::max(std::min(predictions[i], 1.0L - EPSILON), EPSILON);   // clamped for the log only
         loss += -(t * std::log(p) + (1.0L - t) * std::log(1.0L - p));
+        if (gradients) {
+            // No division by p(1 - p), which is tiny for a saturated sigmoid.
+            gradients[i] = (predictions[i] - t) * inverse_outputs;
+        }
     }
-    return loss / predictions.size();
+    return loss * inverse_outputs;
 }
@@ -18,6 +18,23 @@ public:
      * @return The computed loss value.
      */
     long double compute_loss(const std::vector<long double>& predictions, const std::vector<long double>& targets) const override;
+
+    /**
+     * @brief Computes the batch loss and the training gradient p - t of every output.
+     * p - t is not dL/dp: it is the gradient with respect to the logit of a final sigmoid,
+     * and it is what this loss has always fed back, so the sigmoid layer's backward scales it
+     * once more by p(1 - p). It stays finite however saturated the sigmoid is. For the exact
+     * gradient use BCEWithLogitsLoss on logits instead of a sigmoid layer.
+     * @param predictions Predicted probabilities, batch_size x output_size.
+     * @param targets Binary labels, laid out like the predictions.
+     * @param gradients Receives the gradients, or nullptr.
+     * @param batch_size Number of samples in the batch.
+     * @param output_size Number of outputs per sample.
+     * @return The sum of the per-sample losses.
+     */
+    long double compute_loss_and_gradient(const long double* predictions, const long double* targets,
+                                          long double* gradients, size_t batch_size,
+                                          size_t output_size) const override;
 };
 
 #endif // BINARY_CROSS_ENTROPY_LOSS_H
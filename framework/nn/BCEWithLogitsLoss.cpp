@@ -0,0 +1,47 @@
+#include "BCEWithLogitsLoss.h"
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+
+long double BCEWithLogitsLoss::compute_loss(
+    const std::vector<long double>& predictions,
+    const std::vector<long double>& targets
+) const {
+    if (predictions.size() != targets.size()) {
+        throw std::invalid_argument("Predictions and targets must have the same size.");
+    }
+
+    return compute_loss_and_gradient(predictions.data(), targets.data(), nullptr, 1, predictions.size());
+}
+
+long double BCEWithLogitsLoss::compute_loss_and_gradient(
+    const long double* predictions,
+    const long double* targets,
+    long double* gradients,
+    size_t batch_size,
+    size_t output_size
+) const {
+    const size_t count = batch_size * output_size;
+    const long double inverse_outputs = 1.0L / output_size;
+
+    long double loss = 0.0L;
+    for (size_t i = 0; i < count; ++i) {
+        long double z = predictions[i];
+        long double t = targets[i];
+        long double e = std::exp(-std::fabs(z)); // the only exponential, shared by loss and sigmoid
+        loss += std::max(z, 0.0L) - z * t + std::log1p(e);
+        if (gradients) {
+            long double sigmoid = (z >= 0.0L ? 1.0L : e) / (1.0L + e);
+            gradients[i] = (sigmoid - t) * inverse_outputs;
+        }
+    }
+    return loss * inverse_outputs;
+}
+
+size_t BCEWithLogitsLoss::predicted_class(const long double* prediction, size_t output_size) const {
+    return prediction[0] >= 0.0L ? 1 : 0;
+}
+
+long double BCEWithLogitsLoss::positive_score(const long double* prediction, size_t output_size) const {
+    return 1.0L / (1.0L + std::exp(-prediction[0]));
+}
@@ -0,0 +1,55 @@
+#ifndef BCE_WITH_LOGITS_LOSS_H
+#define BCE_WITH_LOGITS_LOSS_H
+
+#include "LossFunction.h"
+#include <vector>
+
+/**
+ * @class BCEWithLogitsLoss
+ * @brief Binary Cross-Entropy computed directly from logits.
+ *
+ * Replaces a final sigmoid ActivationLayer followed by BinaryCrossEntropyLoss. The loss uses
+ * the log-sum-exp form max(z, 0) - z * t + log(1 + exp(-|z|)), which is stable for any logit,
+ * and its gradient with respect to the logit is sigmoid(z) - t.
+ */
+class BCEWithLogitsLoss : public LossFunction {
+public:
+    /**
+     * @brief Computes the loss for logits and binary targets.
+     * @param predictions The predicted logits.
+     * @param targets The ground truth binary labels (0 or 1).
+     * @return The computed loss value.
+     */
+    long double compute_loss(const std::vector<long double>& predictions, const std::vector<long double>& targets) const override;
+
+    /**
+     * @brief Computes the batch loss and its gradient with respect to the logits.
+     * @param predictions Logits, batch_size x output_size.
+     * @param targets Binary labels, laid out like the predictions.
+     * @param gradients Receives the gradients, or nullptr.
+     * @param batch_size Number of samples in the batch.
+     * @param output_size Number of outputs per sample.
+     * @return The sum of the per-sample losses.
+     */
+    long double compute_loss_and_gradient(const long double* predictions, const long double* targets,
+                                          long double* gradients, size_t batch_size,
+                                          size_t output_size) const override;
+
+    /**
+     * @brief A logit classifies as positive when it is non-negative.
+     * @param prediction The logits for one sample.
+     * @param output_size Number of outputs per sample.
+     * @return The predicted class index.
+     */
+    size_t predicted_class(const long double* prediction, size_t output_size) const override;
+
+    /**
+     * @brief Returns the sigmoid of the first logit.
+     * @param prediction The logits for one sample.
+     * @param output_size Number of outputs per sample.
+     * @return The probability of class 1.
+     */
+    long double positive_score(const long double* prediction, size_t output_size) const override;
+};
+
+#endif // BCE_WITH_LOGITS_LOSS_H
@@ -0,0 +1,107 @@
+#include "BlockSparseLinearLayer.h"
+#include <algorithm>
+#include <stdexcept>
+
+BlockSparseLinearLayer::BlockSparseLinearLayer(const LinearLayer& layer, size_t block_rows, size_t block_cols)
+    : input_size(layer.get_input_size()), output_size(layer.get_output_size()),
+      block_rows(block_rows), block_cols(block_cols) {
+    if (block_rows == 0 || block_cols == 0) {
+        throw std::invalid_argument("Block dimensions must be positive.");
+    }
+
+    ParameterView weights = layer.get_weights();
+    ParameterView layer_biases = layer.get_biases();
+    biases.assign(layer_biases.begin(), layer_biases.end());
+
+    size_t row_blocks = (output_size + block_rows - 1) / block_rows;
+    size_t col_blocks = (input_size + block_cols - 1) / block_cols;
+    block_row_offsets.reserve(row_blocks + 1);
+    block_row_offsets.push_back(0);
+
+    std::vector<long double> tile(block_rows * block_cols);
+    for (size_t br = 0; br < row_blocks; ++br) {
+        size_t row_end = std::min(output_size, (br + 1) * block_rows);
+        for (size_t bc = 0; bc < col_blocks; ++bc) {
+            size_t col_end = std::min(input_size, (bc + 1) * block_cols);
+
+            std::fill(tile.begin(), tile.end(), 0.0L);
+            bool has_non_zero = false;
+            for (size_t i = br * block_rows; i < row_end; ++i) {
+                for (size_t j = bc * block_cols; j < col_end; ++j) {
+                    long double w = weights[i * input_size + j];
+                    tile[(i - br * block_rows) * block_cols + (j - bc * block_cols)] = w;
+                    has_non_zero = has_non_zero || w != 0.0L;
+                }
+            }
+
+            if (has_non_zero) {
+                block_columns.push_back(static_cast<uint32_t>(bc));
+                block_values.insert(block_values.end(), tile.begin(), tile.end());
+            }
+        }
+        block_row_offsets.push_back(block_columns.size());
+    }
+}
+
+std::vector<long double> BlockSparseLinearLayer::forward(const std::vector<long double>& inputs) {
+    return predict(inputs);
+}
+
+std::vector<long double> BlockSparseLinearLayer::predict(const std::vector<long double>& inputs) const {
+    if (inputs.size() != input_size) {
+        throw std::invalid_argument("Input size does not match the layer's input size.");
+    }
+
+    // pad input and output to whole blocks so the tile loops need no bounds checks
+    size_t row_blocks = block_row_offsets.size() - 1;
+    size_t padded_inputs = (input_size + block_cols - 1) / block_cols * block_cols;
+    std::vector<long double> x(padded_inputs, 0.0L);
+    std::copy(inputs.begin(), inputs.end(), x.begin());
+    std::vector<long double> y(row_blocks * block_rows, 0.0L);
+    std::copy(biases.begin(), biases.end(), y.begin());
+
+    const size_t tile_size = block_rows * block_cols;
+    for (size_t br = 0; br < row_blocks; ++br) {
+        long double* out = y.data() + br * block_rows;
+        for (size_t k = block_row_offsets[br]; k < block_row_offsets[br + 1]; ++k) {
+            const long double* tile = block_values.data() + k * tile_size;
+            const long double* in = x.data() + block_columns[k] * block_cols;
+            for (size_t r = 0; r < block_rows; ++r) {
+                long double sum = 0.0L;
+                for (size_t c = 0; c < block_cols; ++c) {
+                    sum += tile[r * block_cols + c] * in[c];
+                }
+                out[r] += sum;
+            }
+        }
+    }
+
+    y.resize(output_size);
+    return y;
+}
+
+std::vector<long double> BlockSparseLinearLayer::backward(const std::vector<long double>& gradients) {
+    throw std::logic_error("BlockSparseLinearLayer is inference-only and does not support backward.");
+}
+
+std::shared_ptr<Module> BlockSparseLinearLayer::clone() const {
+    return std::make_shared<BlockSparseLinearLayer>(*this);
+}
+
+size_t BlockSparseLinearLayer::stored_blocks() const {
+    return block_columns.size();
+}
+
+long double BlockSparseLinearLayer::block_sparsity() const {
+    size_t row_blocks = block_row_offsets.size() - 1;
+    size_t col_blocks = (input_size + block_cols - 1) / block_cols;
+    size_t total = row_blocks * col_blocks;
+    return total == 0 ? 0.0L : 1.0L - static_cast<long double>(stored_blocks()) / total;
+}
+
+size_t BlockSparseLinearLayer::weight_bytes() const {
+    return block_values.size() * sizeof(long double)
+        + block_columns.size() * sizeof(uint32_t)
+        + block_row_offsets.size() * sizeof(size_t)
+        + biases.size() * sizeof(long double);
+}
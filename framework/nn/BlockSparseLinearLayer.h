@@ -0,0 +1,89 @@
+#ifndef BLOCKSPARSELINEARLAYER_H
+#define BLOCKSPARSELINEARLAYER_H
+
+#include "Module.h"
+#include "LinearLayer.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class BlockSparseLinearLayer
+ * @brief Inference-only fully connected layer storing weights in block compressed rows (BSR).
+ *
+ * The weight matrix is tiled into block_rows x block_cols blocks and only blocks holding a
+ * non-zero weight are stored, each as a dense zero-padded tile. The kernel walks the stored
+ * blocks of every block row, so pruned blocks cost neither memory nor arithmetic.
+ */
+class BlockSparseLinearLayer : public Module {
+private:
+    size_t input_size;
+    size_t output_size;
+    size_t block_rows;
+    size_t block_cols;
+
+    std::vector<size_t> block_row_offsets;      // one entry per block row, plus the end
+    std::vector<uint32_t> block_columns;        // block column index of every stored block
+    std::vector<long double> block_values;      // block_rows * block_cols values per block
+    std::vector<long double> biases;
+
+public:
+    /**
+     * @brief Compresses the weights of a (pruned) LinearLayer.
+     * @param layer The layer to compress; all-zero blocks are dropped.
+     * @param block_rows Rows per block.
+     * @param block_cols Columns per block.
+     * @throws std::invalid_argument if a block dimension is zero.
+     */
+    BlockSparseLinearLayer(const LinearLayer& layer, size_t block_rows = 4, size_t block_cols = 4);
+
+    /**
+     * @brief Performs the forward pass.
+     * @param inputs The input tensor.
+     * @return The output tensor.
+     */
+    std::vector<long double> forward(const std::vector<long double>& inputs) override;
+
+    /**
+     * @brief Performs the forward pass without caching inputs.
+     * @param inputs The input tensor.
+     * @return The output tensor.
+     * @throws std::invalid_argument if the input size does not match.
+     */
+    std::vector<long double> predict(const std::vector<long double>& inputs) const override;
+
+    /**
+     * @brief Not supported, the layer is inference-only.
+     * @throws std::logic_error always.
+     */
+    std::vector<long double> backward(const std::vector<long double>& gradients) override;
+
+    /**
+     * @brief Does nothing, compressed weights are frozen.
+     * @param learning_rate Ignored.
+     */
+    void update_parameters(long double learning_rate) override {}
+
+    /**
+     * @brief Creates an independent copy of the layer.
+     * @return The copy.
+     */
+    std::shared_ptr<Module> clone() const override;
+
+    /**
+     * @brief Returns the number of stored blocks.
+     */
+    size_t stored_blocks() const;
+
+    /**
+     * @brief Returns the fraction of blocks that were dropped.
+     */
+    long double block_sparsity() const;
+
+    /**
+     * @brief Returns how many bytes the blocks, their indices and the biases occupy.
+     */
+    size_t weight_bytes() const;
+};
+
+#endif // BLOCKSPARSELINEARLAYER_H
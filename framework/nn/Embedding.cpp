@@ -0,0 +1,188 @@
+#include "Embedding.h"
+#include "Optimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+Embedding::Embedding(size_t num_embeddings, size_t embedding_dim, size_t num_fields)
+    : num_embeddings(num_embeddings), embedding_dim(embedding_dim), num_fields(num_fields),
+      table_storage(num_embeddings * embedding_dim) {
+    table = table_storage.data();
+    initialize_table();
+}
+
+Embedding::Embedding(size_t num_embeddings, size_t embedding_dim, size_t num_fields, const std::string& table_path)
+    : num_embeddings(num_embeddings), embedding_dim(embedding_dim), num_fields(num_fields) {
+    mapping_bytes = num_embeddings * embedding_dim * sizeof(long double);
+
+    int fd = open(table_path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Unable to open embedding table: " + table_path);
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        throw std::runtime_error("Unable to stat embedding table: " + table_path);
+    }
+
+    bool is_new = info.st_size == 0;
+    if (is_new && ftruncate(fd, static_cast<off_t>(mapping_bytes)) != 0) {
+        close(fd);
+        throw std::runtime_error("Unable to size embedding table: " + table_path);
+    }
+    if (!is_new && static_cast<size_t>(info.st_size) != mapping_bytes) {
+        close(fd);
+        throw std::runtime_error("Embedding table has the wrong size: " + table_path);
+    }
+
+    mapping = mmap(nullptr, mapping_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        throw std::runtime_error("Unable to map embedding table: " + table_path);
+    }
+
+    table = static_cast<long double*>(mapping);
+    if (is_new) {
+        initialize_table();
+    }
+}
+
+Embedding::~Embedding() {
+    if (mapping) {
+        munmap(mapping, mapping_bytes);
+    }
+}
+
+void Embedding::initialize_table() {
+    std::random_device rd;
+    std::default_random_engine generator(rd());
+    std::normal_distribution<long double> dist(0.0L, 1.0L);
+
+    for (size_t i = 0; i < num_embeddings * embedding_dim; ++i) {
+        table[i] = dist(generator);
+    }
+}
+
+std::vector<size_t> Embedding::lookup_ids(const std::vector<long double>& inputs) const {
+    if (inputs.size() < num_fields) {
+        throw std::invalid_argument("Input size is smaller than the number of ID fields.");
+    }
+
+    std::vector<size_t> ids(num_fields);
+    for (size_t f = 0; f < num_fields; ++f) {
+        long double id = inputs[f];
+        if (id < 0.0L || id >= static_cast<long double>(num_embeddings) || id != std::floor(id)) {
+            throw std::invalid_argument("Embedding ID is not a valid table row.");
+        }
+        ids[f] = static_cast<size_t>(id);
+    }
+    return ids;
+}
+
+std::vector<long double> Embedding::forward(const std::vector<long double>& inputs) {
+    ids_cache = lookup_ids(inputs);
+    passthrough_cache = inputs.size() - num_fields;
+    return predict(inputs);
+}
+
+std::vector<long double> Embedding::predict(const std::vector<long double>& inputs) const {
+    std::vector<size_t> ids = lookup_ids(inputs);
+
+    std::vector<long double> outputs(num_fields * embedding_dim + inputs.size() - num_fields);
+    for (size_t f = 0; f < num_fields; ++f) {
+        const long double* row = table + ids[f] * embedding_dim;
+        std::copy(row, row + embedding_dim, outputs.begin() + f * embedding_dim);
+    }
+    std::copy(inputs.begin() + num_fields, inputs.end(), outputs.begin() + num_fields * embedding_dim);
+
+    return outputs;
+}
+
+std::vector<long double> Embedding::backward(const std::vector<long double>& gradients) {
+    for (size_t f = 0; f < num_fields; ++f) {
+        auto [it, inserted] = touched_rows.emplace(ids_cache[f], touched_order.size());
+        if (inserted) {
+            touched_order.push_back(ids_cache[f]);
+            row_gradients.resize(row_gradients.size() + embedding_dim, 0.0L);
+        }
+
+        long double* gradient_row = row_gradients.data() + it->second * embedding_dim;
+        const long double* output_gradient = gradients.data() + f * embedding_dim;
+        for (size_t d = 0; d < embedding_dim; ++d) {
+            gradient_row[d] += output_gradient[d];
+        }
+    }
+
+    std::vector<long double> input_gradients(num_fields + passthrough_cache, 0.0L);
+    std::copy(gradients.begin() + num_fields * embedding_dim, gradients.end(), input_gradients.begin() + num_fields);
+    return input_gradients;
+}
+
+void Embedding::update_parameters(long double learning_rate) {
+    update_sparse_parameters(learning_rate);
+}
+
+void Embedding::update_sparse_parameters(long double learning_rate, long double gradient_scale) {
+    const long double step = learning_rate * gradient_scale;
+    for (size_t slot = 0; slot < touched_order.size(); ++slot) {
+        long double* row = table + touched_order[slot] * embedding_dim;
+        const long double* gradient_row = row_gradients.data() + slot * embedding_dim;
+        for (size_t d = 0; d < embedding_dim; ++d) {
+            row[d] -= step * gradient_row[d];
+        }
+    }
+
+    touched_rows.clear();
+    touched_order.clear();
+    row_gradients.clear();
+}
+
+void Embedding::step_sparse_parameters(Optimizer& optimizer, long double gradient_scale) {
+    optimizer.sparse_step(get_table(), embedding_dim, touched_order, row_gradients.data(), gradient_scale);
+
+    touched_rows.clear();
+    touched_order.clear();
+    row_gradients.clear();
+}
+
+void Embedding::copy_parameters_from(const Module& source) {
+    const auto* other = dynamic_cast<const Embedding*>(&source);
+    if (!other || other->num_embeddings != num_embeddings || other->embedding_dim != embedding_dim) {
+        throw std::invalid_argument("Source is not an Embedding of the same shape.");
+    }
+    std::copy(other->table, other->table + num_embeddings * embedding_dim, table);
+}
+
+std::shared_ptr<Module> Embedding::clone() const {
+    auto copy = std::make_shared<Embedding>(num_embeddings, embedding_dim, num_fields);
+    copy->copy_parameters_from(*this);
+    return copy;
+}
+
+ParameterView Embedding::get_table() const {
+    return {table, num_embeddings * embedding_dim};
+}
+
+size_t Embedding::pending_rows() const {
+    return touched_order.size();
+}
+
+bool Embedding::is_memory_mapped() const {
+    return mapping != nullptr;
+}
+
+bool Embedding::has_sparse_parameters() const {
+    return true;
+}
+
+bool Embedding::sparse_gradients_finite() const {
+    return std::all_of(row_gradients.begin(), row_gradients.end(),
+                       [](long double g) { return std::isfinite(g); });
+}
@@ -0,0 +1,166 @@
+#ifndef EMBEDDING_H
+#define EMBEDDING_H
+
+#include "Module.h"
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <cstddef>
+
+/**
+ * @class Embedding
+ * @brief Lookup table mapping categorical IDs to learned dense vectors.
+ *
+ * The first num_fields inputs are IDs in [0, num_embeddings); each is replaced by its table
+ * row and the remaining inputs are passed through unchanged, so categorical and numeric
+ * columns can share one DataFrame.
+ *
+ * The table lives outside the model's flat ParameterStore so that dense optimizer sweeps do
+ * not grow with the vocabulary. Backward scatter-adds into per-row gradients kept only for
+ * the rows looked up since the last update, and updates touch those rows alone: through
+ * the training optimizer's sparse_step (with its momentum, moments and weight decay kept
+ * per row), or with plain gradient descent through update_sparse_parameters. The table
+ * can be memory-mapped from a file for vocabularies that should not be held in memory.
+ */
+class Embedding : public Module {
+private:
+    size_t num_embeddings;
+    size_t embedding_dim;
+    size_t num_fields;
+
+    std::vector<long double> table_storage;
+    long double* table = nullptr;
+    void* mapping = nullptr;
+    size_t mapping_bytes = 0;
+
+    std::unordered_map<size_t, size_t> touched_rows;  // table row -> slot in row_gradients
+    std::vector<size_t> touched_order;
+    std::vector<long double> row_gradients;
+    std::vector<size_t> ids_cache;
+    size_t passthrough_cache = 0;
+
+    /**
+     * @brief Validates and converts the ID inputs.
+     * @param inputs The input tensor.
+     * @return The table row of each field.
+     */
+    std::vector<size_t> lookup_ids(const std::vector<long double>& inputs) const;
+
+    /**
+     * @brief Fills the table with draws from N(0, 1).
+     */
+    void initialize_table();
+
+public:
+    /**
+     * @brief Constructor for an in-memory Embedding.
+     * @param num_embeddings Number of distinct IDs.
+     * @param embedding_dim Size of each embedding vector.
+     * @param num_fields Number of leading inputs holding IDs.
+     */
+    Embedding(size_t num_embeddings, size_t embedding_dim, size_t num_fields = 1);
+
+    /**
+     * @brief Constructor for an Embedding whose table is memory-mapped from a file.
+     * A missing or empty file is created and randomly initialized; updates are written
+     * back to the file.
+     * @param num_embeddings Number of distinct IDs.
+     * @param embedding_dim Size of each embedding vector.
+     * @param num_fields Number of leading inputs holding IDs.
+     * @param table_path Path of the table file.
+     * @throws std::runtime_error if the file cannot be opened or has the wrong size.
+     */
+    Embedding(size_t num_embeddings, size_t embedding_dim, size_t num_fields, const std::string& table_path);
+
+    Embedding(const Embedding&) = delete;
+    Embedding& operator=(const Embedding&) = delete;
+
+    /**
+     * @brief Unmaps the table file, if any.
+     */
+    ~Embedding() override;
+
+    /**
+     * @brief Performs the forward pass (table lookup).
+     * @param inputs num_fields IDs followed by pass-through features.
+     * @return The concatenated embeddings followed by the pass-through features.
+     * @throws std::invalid_argument if an ID is not an integer in range.
+     */
+    std::vector<long double> forward(const std::vector<long double>& inputs) override;
+
+    /**
+     * @brief Performs the table lookup without caching inputs.
+     * @param inputs num_fields IDs followed by pass-through features.
+     * @return The concatenated embeddings followed by the pass-through features.
+     */
+    std::vector<long double> predict(const std::vector<long double>& inputs) const override;
+
+    /**
+     * @brief Scatter-adds the output gradients into the looked up rows.
+     * @param gradients The gradient of the loss with respect to the output.
+     * @return Zero for the ID inputs, the pass-through gradients otherwise.
+     */
+    std::vector<long double> backward(const std::vector<long double>& gradients) override;
+
+    /**
+     * @brief Updates only the rows that received gradients.
+     * @param learning_rate The learning rate for gradient descent.
+     */
+    void update_parameters(long double learning_rate) override;
+
+    /**
+     * @brief Updates only the rows that received gradients and forgets them.
+     * @param learning_rate The learning rate for gradient descent.
+     * @param gradient_scale Factor applied to the accumulated gradients.
+     */
+    void update_sparse_parameters(long double learning_rate, long double gradient_scale = 1.0L) override;
+
+    /**
+     * @brief Updates only the rows that received gradients with the optimizer and forgets them.
+     * @param optimizer The training optimizer.
+     * @param gradient_scale Factor applied to the accumulated gradients.
+     */
+    void step_sparse_parameters(Optimizer& optimizer, long double gradient_scale = 1.0L) override;
+
+    /**
+     * @brief Copies the table of another Embedding of the same shape.
+     * @param source The Embedding to copy from.
+     * @throws std::invalid_argument if source is not an Embedding of the same shape.
+     */
+    void copy_parameters_from(const Module& source) override;
+
+    /**
+     * @brief Creates an in-memory copy of the Embedding.
+     * A memory-mapped table is copied whole into memory, since the copy must not see later
+     * updates of the original; avoid cloning models with tables too large to hold in memory.
+     * @return The copy.
+     */
+    std::shared_ptr<Module> clone() const override;
+
+    /**
+     * @brief Returns the whole table, row-major, one row per ID.
+     */
+    ParameterView get_table() const;
+
+    /**
+     * @brief Returns how many rows currently hold pending gradients.
+     */
+    size_t pending_rows() const;
+
+    /**
+     * @brief Returns whether the table is memory-mapped from a file.
+     */
+    bool is_memory_mapped() const;
+
+    /**
+     * @brief Returns true: the table lives outside the flat store.
+     */
+    bool has_sparse_parameters() const override;
+
+    /**
+     * @brief Returns whether the gradients of the pending rows are all finite.
+     */
+    bool sparse_gradients_finite() const override;
+};
+
+#endif // EMBEDDING_H
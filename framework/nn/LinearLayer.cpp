@@ -10,45 +10,88 @@ LinearLayer::LinearLayer(size_t input_size, size_t output_size)
     std::default_random_engine generator(rd());
     std::normal_distribution<long double> he_dist(0.0L, std::sqrt(2.0L / input_size));
 
-    weights.resize(output_size, std::vector<long double>(input_size));
-    biases.resize(output_size);
-    gradients_weights.resize(output_size, std::vector<long double>(input_size, 0.0L));
-    gradients_biases.resize(output_size, 0.0L);
-
-    for (auto& row : weights) {
-        for (auto& weight : row) {
-            weight = he_dist(generator);
-        }
+    LinearLayer::bind_parameters(std::make_shared<ParameterStore>(parameter_count()), 0);
+
+    for (size_t i = 0; i < output_size * input_size; ++i) {
+        weights[i] = he_dist(generator);
     }
 
-    for (auto& bias : biases) {
-        bias = 0.0L;
+    for (size_t i = 0; i < output_size; ++i) {
+        biases[i] = 0.0L;
     }
 }
 
 
 std::vector<long double> LinearLayer::forward(const std::vector<long double>& inputs) {
+    auto outputs = predict(inputs);
+    inputs_cache = inputs;
+    sparse_input = false;
+    return outputs;
+}
+
+std::vector<long double> LinearLayer::forward_sparse(const SparseRow& inputs) {
+    auto outputs = predict_sparse(inputs);
+    sparse_indices_cache.assign(inputs.indices, inputs.indices + inputs.size);
+    inputs_cache.assign(inputs.values, inputs.values + inputs.size);
+    sparse_input = true;
+    return outputs;
+}
+
+std::vector<long double> LinearLayer::predict_sparse(const SparseRow& inputs) const {
+    if (inputs.dimension != input_size) {
+        throw std::invalid_argument("Input size does not match the layer's input size.");
+    }
+
+    std::vector<long double> outputs(biases, biases + output_size);
+
+    for (size_t i = 0; i < output_size; ++i) {
+        const long double* row = weights + i * input_size;
+        long double sum = 0.0L;
+        for (size_t k = 0; k < inputs.size; ++k) {
+            sum += row[inputs.indices[k]] * inputs.values[k];
+        }
+        outputs[i] += sum;
+    }
+
+    return outputs;
+}
+
+std::vector<long double> LinearLayer::predict(const std::vector<long double>& inputs) const {
     if (inputs.size() != input_size) {
         throw std::invalid_argument("Input size does not match the layer's input size.");
     }
 
-    inputs_cache = inputs;
     std::vector<long double> outputs(output_size, 0.0L);
 
     for (size_t i = 0; i < output_size; ++i) {
-        outputs[i] = std::inner_product(inputs.begin(), inputs.end(), weights[i].begin(), biases[i]);
+        const long double* row = weights + i * input_size;
+        outputs[i] = std::inner_product(inputs.begin(), inputs.end(), row, biases[i]);
     }
 
     return outputs;
 }
 
 std::vector<long double> LinearLayer::backward(const std::vector<long double>& gradients) {
+    if (sparse_input) {
+        // the input is data, so no input gradient is needed; only non-zero columns are touched
+        for (size_t i = 0; i < output_size; ++i) {
+            long double* gradient_row = gradients_weights + i * input_size;
+            for (size_t k = 0; k < sparse_indices_cache.size(); ++k) {
+                gradient_row[sparse_indices_cache[k]] += gradients[i] * inputs_cache[k];
+            }
+            gradients_biases[i] += gradients[i];
+        }
+        return {};
+    }
+
     std::vector<long double> input_gradients(input_size, 0.0L);
 
     for (size_t i = 0; i < output_size; ++i) {
+        const long double* row = weights + i * input_size;
+        long double* gradient_row = gradients_weights + i * input_size;
         for (size_t j = 0; j < input_size; ++j) {
-            input_gradients[j] += gradients[i] * weights[i][j];
-            gradients_weights[i][j] += gradients[i] * inputs_cache[j];
+            input_gradients[j] += gradients[i] * row[j];
+            gradient_row[j] += gradients[i] * inputs_cache[j];
         }
         gradients_biases[i] += gradients[i];
     }
@@ -56,13 +99,52 @@ std::vector<long double> LinearLayer::backward(const std::vector<long double>& g
     return input_gradients;
 }
 
-void LinearLayer::update_parameters(long double learning_rate) {
-    for (size_t i = 0; i < output_size; ++i) {
-        for (size_t j = 0; j < input_size; ++j) {
-            weights[i][j] -= learning_rate * gradients_weights[i][j];
-            gradients_weights[i][j] = 0.0L;
-        }
-        biases[i] -= learning_rate * gradients_biases[i];
-        gradients_biases[i] = 0.0L;
-    }
+void LinearLayer::release_cache() {
+    std::vector<long double>().swap(inputs_cache);
+    std::vector<uint32_t>().swap(sparse_indices_cache);
+}
+
+double LinearLayer::forward_flops() const {
+    return 2.0 * input_size * output_size;
+}
+
+double LinearLayer::forward_bytes() const {
+    return static_cast<double>((input_size + 1) * output_size + input_size + output_size) * sizeof(long double);
+}
+
+size_t LinearLayer::parameter_count() const {
+    return (input_size + 1) * output_size;
+}
+
+void LinearLayer::bind_parameters(const std::shared_ptr<ParameterStore>& store, size_t offset) {
+    Module::bind_parameters(store, offset);
+
+    ParameterView values = parameters();
+    ParameterView grads = gradients();
+    weights = values.data;
+    biases = values.data + output_size * input_size;
+    gradients_weights = grads.data;
+    gradients_biases = grads.data ? grads.data + output_size * input_size : nullptr;
+}
+
+std::shared_ptr<Module> LinearLayer::clone() const {
+    auto copy = std::make_shared<LinearLayer>(*this);
+    copy->bind_parameters(std::make_shared<ParameterStore>(parameter_count()), 0);
+    return copy;
+}
+
+size_t LinearLayer::get_input_size() const {
+    return input_size;
+}
+
+size_t LinearLayer::get_output_size() const {
+    return output_size;
+}
+
+ParameterView LinearLayer::get_weights() const {
+    return {weights, output_size * input_size};
+}
+
+ParameterView LinearLayer::get_biases() const {
+    return {biases, output_size};
 }
@@ -3,21 +3,28 @@
 
 #include "Module.h"
 #include <vector>
+#include <cstddef>
+#include <cstdint>
 
 /**
  * @class LinearLayer
  * @brief Fully connected layer implementation.
+ *
+ * Parameters are laid out as the row-major weight matrix (one row per output feature)
+ * followed by the biases, inside the layer's ParameterStore.
  */
 class LinearLayer : public Module {
 private:
     size_t input_size;
     size_t output_size;
 
-    std::vector<std::vector<long double>> weights;
-    std::vector<long double> biases;
-    std::vector<std::vector<long double>> gradients_weights;
-    std::vector<long double> gradients_biases;
+    long double* weights = nullptr;
+    long double* biases = nullptr;
+    long double* gradients_weights = nullptr;
+    long double* gradients_biases = nullptr;
     std::vector<long double> inputs_cache;
+    std::vector<uint32_t> sparse_indices_cache;
+    bool sparse_input = false;
 
 public:
     /**
@@ -34,18 +41,90 @@ public:
      */
     std::vector<long double> forward(const std::vector<long double>& inputs) override;
 
+    /**
+     * @brief Performs the forward pass without caching inputs.
+     * @param inputs The input tensor.
+     * @return The output tensor.
+     */
+    std::vector<long double> predict(const std::vector<long double>& inputs) const override;
+
+    /**
+     * @brief Performs the forward pass for a sparse input, reading only the weight columns
+     * of its non-zero features.
+     * @param inputs The sparse input row.
+     * @return The output tensor.
+     */
+    std::vector<long double> forward_sparse(const SparseRow& inputs) override;
+
+    /**
+     * @brief Performs the sparse forward pass without caching inputs.
+     * @param inputs The sparse input row.
+     * @return The output tensor.
+     */
+    std::vector<long double> predict_sparse(const SparseRow& inputs) const override;
+
     /**
      * @brief Performs the backward pass.
      * @param gradients The gradient of the loss with respect to the output.
-     * @return The gradient of the loss with respect to the input.
+     * @return The gradient of the loss with respect to the input, or an empty vector when
+     * the last forward pass was sparse (only the non-zero weight columns receive gradients).
      */
     std::vector<long double> backward(const std::vector<long double>& gradients) override;
 
     /**
-     * @brief Updates the weights and biases using the computed gradients.
-     * @param learning_rate The learning rate for gradient descent.
+     * @brief Frees the cached inputs.
+     */
+    void release_cache() override;
+
+    /**
+     * @brief Returns the floating-point operations of one forward pass (2 * input * output).
+     */
+    double forward_flops() const override;
+
+    /**
+     * @brief Returns the bytes of weights, biases, inputs and outputs touched by one forward pass.
+     */
+    double forward_bytes() const override;
+
+    /**
+     * @brief Returns the number of weights plus biases.
+     */
+    size_t parameter_count() const override;
+
+    /**
+     * @brief Moves the weights and biases into a store.
+     * @param store The store to register into.
+     * @param offset Position of the first weight inside the store.
+     */
+    void bind_parameters(const std::shared_ptr<ParameterStore>& store, size_t offset) override;
+
+    /**
+     * @brief Creates an independent copy of the layer.
+     * @return The copy.
+     */
+    std::shared_ptr<Module> clone() const override;
+
+    /**
+     * @brief Returns the number of input features.
+     */
+    size_t get_input_size() const;
+
+    /**
+     * @brief Returns the number of output features.
+     */
+    size_t get_output_size() const;
+
+    /**
+     * @brief Returns the row-major weight matrix, one row per output feature.
+     * @return A view of output_size * input_size weights.
+     */
+    ParameterView get_weights() const;
+
+    /**
+     * @brief Returns the bias vector.
+     * @return A view of output_size biases.
      */
-    void update_parameters(long double learning_rate) override;
+    ParameterView get_biases() const;
 };
 
 #endif // LINEARLAYER_H
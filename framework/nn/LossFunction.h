@@ -2,6 +2,7 @@
 #define LOSS_FUNCTION_H
 
 #include <vector>
+#include <cstddef>
 
 /**
  * @class LossFunction
@@ -18,6 +19,53 @@ public:
      * @return The computed loss value.
      */
     virtual long double compute_loss(const std::vector<long double>& predictions, const std::vector<long double>& targets) const = 0;
+
+    /**
+     * @brief Computes the loss of a batch and its gradient in one pass over contiguous buffers.
+     * @param predictions Row-major batch_size x output_size model outputs.
+     * @param targets Row-major targets, laid out like the predictions unless the loss says otherwise.
+     * @param gradients Receives the gradient of each sample's loss with respect to its outputs,
+     * laid out like the predictions. May be nullptr when only the loss is needed.
+     * @param batch_size Number of samples in the batch.
+     * @param output_size Number of outputs per sample.
+     * @return The sum of the per-sample losses.
+     */
+    virtual long double compute_loss_and_gradient(const long double* predictions, const long double* targets,
+                                                  long double* gradients, size_t batch_size,
+                                                  size_t output_size) const = 0;
+
+    /**
+     * @brief Returns the class a single prediction stands for.
+     * The default thresholds the first output, a probability, at 0.5.
+     * @param prediction The model outputs for one sample.
+     * @param output_size Number of outputs per sample.
+     * @return The predicted class index.
+     */
+    virtual size_t predicted_class(const long double* prediction, size_t output_size) const {
+        return prediction[0] >= 0.5L ? 1 : 0;
+    }
+
+    /**
+     * @brief Returns the probability the prediction assigns to class 1, used for ROC curves.
+     * The default reads the first output as a probability.
+     * @param prediction The model outputs for one sample.
+     * @param output_size Number of outputs per sample.
+     * @return A score in [0, 1].
+     */
+    virtual long double positive_score(const long double* prediction, size_t output_size) const {
+        return prediction[0];
+    }
+
+    /**
+     * @brief Checks whether a single prediction classifies its target correctly.
+     * @param prediction The model outputs for one sample.
+     * @param target The target row for that sample, holding the class in its first element.
+     * @param output_size Number of outputs per sample.
+     * @return True if the predicted class matches the target.
+     */
+    virtual bool is_correct(const long double* prediction, const long double* target, size_t output_size) const {
+        return static_cast<long double>(predicted_class(prediction, output_size)) == target[0];
+    }
 };
 
 #endif // LOSS_FUNCTION_H
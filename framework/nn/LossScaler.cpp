@@ -0,0 +1,38 @@
+#include "LossScaler.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+LossScaler::LossScaler(long double initial_scale, size_t growth_interval)
+    : scale(initial_scale), growth_interval(growth_interval) {
+    if (!(initial_scale > 0.0L)) {
+        throw std::invalid_argument("Loss scale must be positive.");
+    }
+}
+
+long double LossScaler::get_scale() const {
+    return scale;
+}
+
+bool LossScaler::update(ParameterView gradients, bool others_finite) {
+    bool finite = others_finite && std::all_of(gradients.begin(), gradients.end(),
+                                               [](long double g) { return std::isfinite(g); });
+
+    if (!finite) {
+        std::fill(gradients.begin(), gradients.end(), 0.0L);
+        scale = std::max(scale / 2.0L, 1.0L);
+        clean_steps = 0;
+        ++skipped_steps;
+        return false;
+    }
+
+    if (growth_interval > 0 && ++clean_steps == growth_interval) {
+        scale *= 2.0L;
+        clean_steps = 0;
+    }
+    return true;
+}
+
+size_t LossScaler::get_skipped_steps() const {
+    return skipped_steps;
+}
@@ -0,0 +1,52 @@
+#ifndef LOSSSCALER_H
+#define LOSSSCALER_H
+
+#include "ParameterStore.h"
+#include <cstddef>
+
+/**
+ * @class LossScaler
+ * @brief Dynamic loss scaling for mixed-precision training.
+ *
+ * The loss gradient is multiplied by the scale before backward so that small gradients do
+ * not underflow in low precision; the optimizer divides it out again. A step whose gradients
+ * overflowed is skipped and the scale halved; after growth_interval clean steps it doubles.
+ */
+class LossScaler {
+private:
+    long double scale;
+    size_t growth_interval;
+    size_t clean_steps = 0;
+    size_t skipped_steps = 0;
+
+public:
+    /**
+     * @brief Constructor for LossScaler.
+     * @param initial_scale Starting scale factor.
+     * @param growth_interval Clean steps before the scale doubles (0 keeps it fixed unless it overflows).
+     * @throws std::invalid_argument if initial_scale is not positive.
+     */
+    explicit LossScaler(long double initial_scale = 65536.0L, size_t growth_interval = 2000);
+
+    /**
+     * @brief Returns the current scale factor.
+     */
+    long double get_scale() const;
+
+    /**
+     * @brief Checks the accumulated gradients before a step and adapts the scale.
+     * On overflow the gradients are zeroed and the scale halved.
+     * @param gradients The scaled gradients.
+     * @param others_finite Whether the scaled gradients kept outside the view (e.g. the
+     * pending Embedding rows) are finite; the caller discards those on overflow.
+     * @return False if the step must be skipped.
+     */
+    bool update(ParameterView gradients, bool others_finite = true);
+
+    /**
+     * @brief Returns how many steps were skipped because of overflow.
+     */
+    size_t get_skipped_steps() const;
+};
+
+#endif // LOSSSCALER_H
@@ -0,0 +1,53 @@
+#ifndef LOWPRECISION_H
+#define LOWPRECISION_H
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+/**
+ * @enum StoragePrecision
+ * @brief Storage format of weights and activations in mixed-precision layers.
+ */
+enum class StoragePrecision {
+    Float32,
+    BFloat16    ///< Upper 16 bits of a float32: same range, 8-bit mantissa.
+};
+
+/**
+ * @namespace LowPrecision
+ * @brief Conversions between float32 and bfloat16.
+ */
+namespace LowPrecision {
+    /**
+     * @brief Rounds a float to bfloat16 (round to nearest even, NaN preserved).
+     */
+    inline uint16_t to_bfloat16(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        if (std::isnan(value)) {
+            return static_cast<uint16_t>((bits >> 16) | 0x40u);
+        }
+        bits += 0x7FFFu + ((bits >> 16) & 1u);
+        return static_cast<uint16_t>(bits >> 16);
+    }
+
+    /**
+     * @brief Widens a bfloat16 to float (exact).
+     */
+    inline float from_bfloat16(uint16_t value) {
+        uint32_t bits = static_cast<uint32_t>(value) << 16;
+        float result;
+        std::memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    /**
+     * @brief Rounds a float to the given storage precision and back.
+     */
+    inline float round_to(float value, StoragePrecision precision) {
+        return precision == StoragePrecision::BFloat16 ? from_bfloat16(to_bfloat16(value)) : value;
+    }
+}
+
+#endif // LOWPRECISION_H
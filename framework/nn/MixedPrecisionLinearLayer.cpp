@@ -0,0 +1,174 @@
+#include "MixedPrecisionLinearLayer.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+MixedPrecisionLinearLayer::MixedPrecisionLinearLayer(size_t input_size, size_t output_size, StoragePrecision precision)
+    : input_size(input_size), output_size(output_size), precision(precision) {
+    std::random_device rd;
+    std::default_random_engine generator(rd());
+    std::normal_distribution<long double> he_dist(0.0L, std::sqrt(2.0L / input_size));
+
+    MixedPrecisionLinearLayer::bind_parameters(std::make_shared<ParameterStore>(parameter_count()), 0);
+
+    for (size_t i = 0; i < output_size * input_size; ++i) {
+        weights[i] = he_dist(generator);
+    }
+    std::fill(biases, biases + output_size, 0.0L);
+
+    refresh_parameters();
+}
+
+MixedPrecisionLinearLayer::MixedPrecisionLinearLayer(const LinearLayer& layer, StoragePrecision precision)
+    : input_size(layer.get_input_size()), output_size(layer.get_output_size()), precision(precision) {
+    MixedPrecisionLinearLayer::bind_parameters(std::make_shared<ParameterStore>(parameter_count()), 0);
+    Module::copy_parameters_from(layer);
+}
+
+float MixedPrecisionLinearLayer::weight(size_t index) const {
+    return precision == StoragePrecision::BFloat16
+        ? LowPrecision::from_bfloat16(weights_bf16[index])
+        : weights_f32[index];
+}
+
+std::vector<float> MixedPrecisionLinearLayer::store_inputs(const std::vector<long double>& inputs) const {
+    if (inputs.size() != input_size) {
+        throw std::invalid_argument("Input size does not match the layer's input size.");
+    }
+
+    std::vector<float> stored(input_size);
+    for (size_t j = 0; j < input_size; ++j) {
+        stored[j] = LowPrecision::round_to(static_cast<float>(inputs[j]), precision);
+    }
+    return stored;
+}
+
+std::vector<long double> MixedPrecisionLinearLayer::compute(const std::vector<float>& inputs) const {
+    std::vector<long double> outputs(output_size);
+
+    if (precision == StoragePrecision::BFloat16) {
+        std::vector<float> row(input_size);
+        for (size_t i = 0; i < output_size; ++i) {
+            const uint16_t* packed = weights_bf16.data() + i * input_size;
+            for (size_t j = 0; j < input_size; ++j) {
+                row[j] = LowPrecision::from_bfloat16(packed[j]);
+            }
+            float sum = 0.0f;
+            for (size_t j = 0; j < input_size; ++j) {
+                sum += row[j] * inputs[j];
+            }
+            outputs[i] = LowPrecision::round_to(sum + biases_f32[i], precision);
+        }
+    } else {
+        for (size_t i = 0; i < output_size; ++i) {
+            const float* row = weights_f32.data() + i * input_size;
+            float sum = 0.0f;
+            for (size_t j = 0; j < input_size; ++j) {
+                sum += row[j] * inputs[j];
+            }
+            outputs[i] = sum + biases_f32[i];
+        }
+    }
+
+    return outputs;
+}
+
+std::vector<long double> MixedPrecisionLinearLayer::forward(const std::vector<long double>& inputs) {
+    std::vector<float> stored = store_inputs(inputs);
+
+    if (precision == StoragePrecision::BFloat16) {
+        inputs_cache_bf16.resize(input_size);
+        for (size_t j = 0; j < input_size; ++j) {
+            inputs_cache_bf16[j] = LowPrecision::to_bfloat16(stored[j]);
+        }
+    } else {
+        inputs_cache_f32 = stored;
+    }
+
+    return compute(stored);
+}
+
+std::vector<long double> MixedPrecisionLinearLayer::predict(const std::vector<long double>& inputs) const {
+    return compute(store_inputs(inputs));
+}
+
+std::vector<long double> MixedPrecisionLinearLayer::backward(const std::vector<long double>& gradients) {
+    std::vector<float> cached(input_size);
+    for (size_t j = 0; j < input_size; ++j) {
+        cached[j] = precision == StoragePrecision::BFloat16
+            ? LowPrecision::from_bfloat16(inputs_cache_bf16[j])
+            : inputs_cache_f32[j];
+    }
+
+    std::vector<float> input_gradients(input_size, 0.0f);
+    for (size_t i = 0; i < output_size; ++i) {
+        float g = static_cast<float>(gradients[i]);
+        long double* gradient_row = gradients_weights + i * input_size;
+        for (size_t j = 0; j < input_size; ++j) {
+            input_gradients[j] += g * weight(i * input_size + j);
+            gradient_row[j] += static_cast<long double>(g * cached[j]);
+        }
+        gradients_biases[i] += g;
+    }
+
+    std::vector<long double> result(input_size);
+    for (size_t j = 0; j < input_size; ++j) {
+        result[j] = LowPrecision::round_to(input_gradients[j], precision);
+    }
+    return result;
+}
+
+void MixedPrecisionLinearLayer::update_parameters(long double learning_rate) {
+    Module::update_parameters(learning_rate);
+    refresh_parameters();
+}
+
+void MixedPrecisionLinearLayer::refresh_parameters() {
+    size_t count = output_size * input_size;
+    if (precision == StoragePrecision::BFloat16) {
+        weights_bf16.resize(count);
+        for (size_t k = 0; k < count; ++k) {
+            weights_bf16[k] = LowPrecision::to_bfloat16(static_cast<float>(weights[k]));
+        }
+    } else {
+        weights_f32.assign(weights, weights + count);
+    }
+    biases_f32.assign(biases, biases + output_size);
+}
+
+void MixedPrecisionLinearLayer::release_cache() {
+    std::vector<float>().swap(inputs_cache_f32);
+    std::vector<uint16_t>().swap(inputs_cache_bf16);
+}
+
+size_t MixedPrecisionLinearLayer::parameter_count() const {
+    return (input_size + 1) * output_size;
+}
+
+void MixedPrecisionLinearLayer::bind_parameters(const std::shared_ptr<ParameterStore>& store, size_t offset) {
+    Module::bind_parameters(store, offset);
+
+    ParameterView values = parameters();
+    ParameterView grads = gradients();
+    weights = values.data;
+    biases = values.data + output_size * input_size;
+    gradients_weights = grads.data;
+    gradients_biases = grads.data ? grads.data + output_size * input_size : nullptr;
+}
+
+std::shared_ptr<Module> MixedPrecisionLinearLayer::clone() const {
+    auto copy = std::make_shared<MixedPrecisionLinearLayer>(*this);
+    copy->bind_parameters(std::make_shared<ParameterStore>(parameter_count()), 0);
+    return copy;
+}
+
+StoragePrecision MixedPrecisionLinearLayer::get_precision() const {
+    return precision;
+}
+
+size_t MixedPrecisionLinearLayer::weight_bytes() const {
+    return weights_f32.size() * sizeof(float)
+        + weights_bf16.size() * sizeof(uint16_t)
+        + biases_f32.size() * sizeof(float);
+}
@@ -0,0 +1,140 @@
+#ifndef MIXEDPRECISIONLINEARLAYER_H
+#define MIXEDPRECISIONLINEARLAYER_H
+
+#include "Module.h"
+#include "LinearLayer.h"
+#include "LowPrecision.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class MixedPrecisionLinearLayer
+ * @brief Fully connected layer computing in float32 from float32 or bfloat16 storage.
+ *
+ * The master weights stay in the model's ParameterStore in long double, laid out exactly
+ * like LinearLayer, so optimizers update them at full precision. Forward and backward read
+ * a low-precision copy of the weights, accumulate dot products in float32 and cache the
+ * inputs in the storage precision. The copy is rebuilt by refresh_parameters(), which the
+ * training loop calls after every update.
+ */
+class MixedPrecisionLinearLayer : public Module {
+private:
+    size_t input_size;
+    size_t output_size;
+    StoragePrecision precision;
+
+    long double* weights = nullptr;
+    long double* biases = nullptr;
+    long double* gradients_weights = nullptr;
+    long double* gradients_biases = nullptr;
+
+    std::vector<float> weights_f32;          // used with StoragePrecision::Float32
+    std::vector<uint16_t> weights_bf16;      // used with StoragePrecision::BFloat16
+    std::vector<float> biases_f32;
+    std::vector<float> inputs_cache_f32;
+    std::vector<uint16_t> inputs_cache_bf16;
+
+    /**
+     * @brief Converts an input row to the storage precision.
+     */
+    std::vector<float> store_inputs(const std::vector<long double>& inputs) const;
+
+    /**
+     * @brief Computes the outputs for inputs already rounded to the storage precision.
+     */
+    std::vector<long double> compute(const std::vector<float>& inputs) const;
+
+    /**
+     * @brief Reads one weight of the low-precision copy by its row-major index.
+     */
+    float weight(size_t index) const;
+
+public:
+    /**
+     * @brief Constructor for MixedPrecisionLinearLayer.
+     * @param input_size Number of input features.
+     * @param output_size Number of output features.
+     * @param precision Storage precision of weights and cached activations.
+     */
+    MixedPrecisionLinearLayer(size_t input_size, size_t output_size,
+                              StoragePrecision precision = StoragePrecision::BFloat16);
+
+    /**
+     * @brief Builds a mixed-precision layer holding the weights of a LinearLayer.
+     * @param layer The layer to copy.
+     * @param precision Storage precision of weights and cached activations.
+     */
+    explicit MixedPrecisionLinearLayer(const LinearLayer& layer,
+                                       StoragePrecision precision = StoragePrecision::BFloat16);
+
+    /**
+     * @brief Performs the forward pass, caching the inputs in the storage precision.
+     * @param inputs The input tensor.
+     * @return The output tensor.
+     */
+    std::vector<long double> forward(const std::vector<long double>& inputs) override;
+
+    /**
+     * @brief Performs the forward pass without caching inputs.
+     * @param inputs The input tensor.
+     * @return The output tensor.
+     * @throws std::invalid_argument if the input size does not match.
+     */
+    std::vector<long double> predict(const std::vector<long double>& inputs) const override;
+
+    /**
+     * @brief Performs the backward pass.
+     * Weight gradients are accumulated into the long double master gradients; the input
+     * gradient is computed from the low-precision weights and rounded to the storage precision.
+     * @param gradients The gradient of the loss with respect to the output.
+     * @return The gradient of the loss with respect to the input.
+     */
+    std::vector<long double> backward(const std::vector<long double>& gradients) override;
+
+    /**
+     * @brief Applies gradient descent to the master weights and refreshes the low-precision copy.
+     * @param learning_rate The learning rate for gradient descent.
+     */
+    void update_parameters(long double learning_rate) override;
+
+    /**
+     * @brief Rebuilds the low-precision weights from the master weights.
+     */
+    void refresh_parameters() override;
+
+    /**
+     * @brief Frees the cached inputs.
+     */
+    void release_cache() override;
+
+    /**
+     * @brief Returns the number of weights plus biases.
+     */
+    size_t parameter_count() const override;
+
+    /**
+     * @brief Moves the master weights and biases into a store.
+     * @param store The store to register into.
+     * @param offset Position of the first weight inside the store.
+     */
+    void bind_parameters(const std::shared_ptr<ParameterStore>& store, size_t offset) override;
+
+    /**
+     * @brief Creates an independent copy of the layer.
+     * @return The copy.
+     */
+    std::shared_ptr<Module> clone() const override;
+
+    /**
+     * @brief Returns the storage precision.
+     */
+    StoragePrecision get_precision() const;
+
+    /**
+     * @brief Returns how many bytes the low-precision weights and biases occupy.
+     */
+    size_t weight_bytes() const;
+};
+
+#endif // MIXEDPRECISIONLINEARLAYER_H
@@ -1,13 +1,24 @@
 #ifndef MODULE_H
 #define MODULE_H
 
+#include "ParameterStore.h"
+#include "SparseRow.h"
 #include <vector>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+class Optimizer;
 
 /**
  * @class Module
  * @brief Abstract base class for all neural network components.
  */
 class Module {
+protected:
+    std::shared_ptr<ParameterStore> parameter_store;
+    size_t parameter_offset = 0;
+
 public:
     virtual ~Module() = default;
 
@@ -18,6 +29,35 @@ public:
      */
     virtual std::vector<long double> forward(const std::vector<long double>& inputs) = 0;
 
+    /**
+     * @brief Inference-only forward pass that keeps no state for backward.
+     * Safe to call from several threads at once while nothing modifies the module.
+     * @param inputs The input tensor.
+     * @return The output tensor.
+     */
+    virtual std::vector<long double> predict(const std::vector<long double>& inputs) const = 0;
+
+    /**
+     * @brief Forward pass for a sparse input, touching only its non-zero entries.
+     * A following backward() computes parameter gradients but returns no input gradient.
+     * @param inputs The sparse input row.
+     * @return The output tensor.
+     * @throws std::logic_error if the module does not accept sparse inputs.
+     */
+    virtual std::vector<long double> forward_sparse(const SparseRow& inputs) {
+        throw std::logic_error("This module does not accept sparse inputs.");
+    }
+
+    /**
+     * @brief Inference-only forward pass for a sparse input.
+     * @param inputs The sparse input row.
+     * @return The output tensor.
+     * @throws std::logic_error if the module does not accept sparse inputs.
+     */
+    virtual std::vector<long double> predict_sparse(const SparseRow& inputs) const {
+        throw std::logic_error("This module does not accept sparse inputs.");
+    }
+
     /**
      * @brief Backward pass for the module.
      * @param gradients The gradient of the loss with respect to the output.
@@ -26,10 +66,137 @@ public:
     virtual std::vector<long double> backward(const std::vector<long double>& gradients) = 0;
 
     /**
-     * @brief Updates the module's parameters using gradients.
+     * @brief Frees the state kept by forward() for backward().
+     */
+    virtual void release_cache() {}
+
+    /**
+     * @brief Updates the module's parameters using gradients and resets the gradients.
+     * Plain gradient descent over the module's flat parameter range.
+     * @param learning_rate The learning rate for gradient descent.
+     */
+    virtual void update_parameters(long double learning_rate) {
+        ParameterView values = parameters();
+        ParameterView grads = gradients();
+        for (size_t i = 0; i < values.size; ++i) {
+            values[i] -= learning_rate * grads[i];
+            grads[i] = 0.0L;
+        }
+    }
+
+    /**
+     * @brief Applies gradient descent to parameters kept outside the flat store and resets
+     * their gradients. Only modules with such parameters (e.g. embedding tables) override it.
      * @param learning_rate The learning rate for gradient descent.
+     * @param gradient_scale Factor applied to the accumulated gradients.
+     */
+    virtual void update_sparse_parameters(long double learning_rate, long double gradient_scale = 1.0L) {}
+
+    /**
+     * @brief Updates parameters kept outside the flat store with an optimizer (see
+     * Optimizer::sparse_step) and resets their gradients. Only modules with such parameters
+     * (e.g. embedding tables) override it.
+     * @param optimizer The optimizer stepping the flat store.
+     * @param gradient_scale Factor applied to the accumulated gradients.
+     */
+    virtual void step_sparse_parameters(Optimizer& optimizer, long double gradient_scale = 1.0L) {}
+
+    /**
+     * @brief Copies every parameter of a module with the same topology into this one.
+     * @param source The module to copy from.
+     * @throws std::invalid_argument if the parameter counts differ.
+     */
+    virtual void copy_parameters_from(const Module& source) {
+        ParameterView values = source.parameters();
+        ParameterView target = parameters();
+        if (values.size != target.size) {
+            throw std::invalid_argument("Source module does not match this module.");
+        }
+        std::copy(values.begin(), values.end(), target.begin());
+        refresh_parameters();
+    }
+
+    /**
+     * @brief Notifies the module that its parameter values were changed from outside,
+     * e.g. by an optimizer step. Modules keeping derived copies of their weights rebuild them.
+     */
+    virtual void refresh_parameters() {}
+
+    /**
+     * @brief Creates an independent copy of the module with its own parameter store.
+     * @return The copy, holding the current parameter values.
+     */
+    virtual std::shared_ptr<Module> clone() const = 0;
+
+    /**
+     * @brief Estimated floating point operations of one forward() call, used by the profiler.
+     */
+    virtual double forward_flops() const { return 0.0; }
+
+    /**
+     * @brief Estimated bytes read and written by one forward() call, used by the profiler.
+     */
+    virtual double forward_bytes() const { return 0.0; }
+
+    /**
+     * @brief Returns how many trainable scalars the module owns.
+     */
+    virtual size_t parameter_count() const { return 0; }
+
+    /**
+     * @brief Returns whether the module has parameters outside the flat store
+     * (see step_sparse_parameters).
+     */
+    virtual bool has_sparse_parameters() const { return false; }
+
+    /**
+     * @brief Returns whether the pending gradients of the out-of-store parameters are all
+     * finite, e.g. for the overflow check of loss scaling.
+     */
+    virtual bool sparse_gradients_finite() const { return true; }
+
+    /**
+     * @brief Moves the module's parameters and gradients into a store.
+     * Current values are copied to [offset, offset + parameter_count()) and the module
+     * reads and writes them there from now on. A read-only store keeps its own values.
+     * @param store The store to register into.
+     * @param offset Position of the module's first scalar inside the store.
+     */
+    virtual void bind_parameters(const std::shared_ptr<ParameterStore>& store, size_t offset) {
+        size_t count = parameter_count();
+        if (parameter_store && count > 0 && !store->is_read_only()) {
+            std::copy_n(parameters().data, count, store->values_view(offset, count).data);
+            // A read-only store (e.g. a shared model) has no gradients to carry over.
+            long double* target_gradients = store->gradients_view(offset, count).data;
+            if (const long double* source_gradients = gradients().data) {
+                std::copy_n(source_gradients, count, target_gradients);
+            } else {
+                std::fill_n(target_gradients, count, 0.0L);
+            }
+        }
+        parameter_store = store;
+        parameter_offset = offset;
+    }
+
+    /**
+     * @brief Returns the module's parameters as one contiguous range.
+     */
+    ParameterView parameters() const {
+        if (!parameter_store) {
+            return {};
+        }
+        return parameter_store->values_view(parameter_offset, parameter_count());
+    }
+
+    /**
+     * @brief Returns the module's gradients, laid out like parameters().
      */
-    virtual void update_parameters(long double learning_rate) = 0;
+    ParameterView gradients() const {
+        if (!parameter_store) {
+            return {};
+        }
+        return parameter_store->gradients_view(parameter_offset, parameter_count());
+    }
 };
 
 #endif // MODULE_H
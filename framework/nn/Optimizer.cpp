@@ -0,0 +1,53 @@
+#include "Optimizer.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+    // below this many elements per thread a step is cheaper than starting a thread
+    constexpr size_t MIN_ELEMENTS_PER_THREAD = 1 << 14;
+}
+
+Optimizer::Optimizer(size_t num_threads)
+    : num_threads(std::max<size_t>(num_threads, 1)) {}
+
+void Optimizer::parallel_for(size_t size, const std::function<void(size_t, size_t)>& kernel) const {
+    size_t threads = std::min(num_threads, std::max<size_t>(size / MIN_ELEMENTS_PER_THREAD, 1));
+    if (threads == 1) {
+        kernel(0, size);
+        return;
+    }
+
+    size_t chunk = (size + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; ++t) {
+        size_t begin = t * chunk;
+        size_t end = std::min(size, begin + chunk);
+        workers.emplace_back(kernel, begin, end);
+    }
+    kernel(0, std::min(size, chunk));
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+Optimizer::SparseRowState& Optimizer::sparse_state(ParameterView table, size_t width) {
+    return sparse_states.try_emplace(table.data, width).first->second;
+}
+
+void Optimizer::sparse_step(ParameterView table, size_t row_size, const std::vector<size_t>& rows,
+                            const long double* gradients, long double gradient_scale) {
+    const long double step = get_learning_rate() * gradient_scale;
+    for (size_t r = 0; r < rows.size(); ++r) {
+        if (row_size == 0 || (rows[r] + 1) * row_size > table.size) {
+            throw std::invalid_argument("Sparse row is outside the table.");
+        }
+        long double* row = table.data + rows[r] * row_size;
+        const long double* gradient_row = gradients + r * row_size;
+        for (size_t d = 0; d < row_size; ++d) {
+            row[d] -= step * gradient_row[d];
+        }
+    }
+}
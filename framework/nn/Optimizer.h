@@ -0,0 +1,117 @@
+#ifndef OPTIMIZER_H
+#define OPTIMIZER_H
+
+#include "ParameterStore.h"
+#include <functional>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class Optimizer
+ * @brief Abstract interface for optimizers working on flat parameter and gradient buffers.
+ *
+ * A step updates every parameter, its optimizer state and resets its gradient in one fused
+ * pass. Large buffers can be split across threads.
+ *
+ * Tables kept outside the flat store (embeddings) are updated row by row with sparse_step.
+ * Their optimizer state is created per row on first use, so it only grows with the rows
+ * that are actually trained.
+ */
+class Optimizer {
+private:
+    size_t num_threads;
+
+protected:
+    /**
+     * @class SparseRowState
+     * @brief Optimizer state of the trained rows of one table, width scalars per row.
+     */
+    class SparseRowState {
+    private:
+        size_t width = 0;
+        std::unordered_map<size_t, size_t> slots;   // table row -> slot
+        std::vector<long double> values;
+        std::vector<size_t> steps;
+
+    public:
+        explicit SparseRowState(size_t width = 0) : width(width) {}
+
+        /**
+         * @brief Returns the state of a row, zero-initialized on first use. The pointer is
+         * valid until the state of another new row is requested.
+         */
+        long double* get(size_t row) {
+            auto [it, inserted] = slots.emplace(row, steps.size());
+            if (inserted) {
+                values.resize(values.size() + width, 0.0L);
+                steps.push_back(0);
+            }
+            return values.data() + it->second * width;
+        }
+
+        /**
+         * @brief Returns how many times a row was updated; the row must have been requested.
+         */
+        size_t& step_count(size_t row) {
+            return steps[slots.at(row)];
+        }
+    };
+
+private:
+    std::unordered_map<const long double*, SparseRowState> sparse_states;
+
+protected:
+    /**
+     * @brief Returns the row state of a table, keyed by the table's address.
+     * @param table The table passed to sparse_step.
+     * @param width Scalars of state per row.
+     */
+    SparseRowState& sparse_state(ParameterView table, size_t width);
+
+    /**
+     * @brief Runs kernel(begin, end) over [0, size), split into contiguous chunks per thread.
+     * @param size Number of elements to process.
+     * @param kernel The function applied to each chunk.
+     */
+    void parallel_for(size_t size, const std::function<void(size_t, size_t)>& kernel) const;
+
+public:
+    /**
+     * @brief Constructor for Optimizer.
+     * @param num_threads Number of threads used by a step (1 runs on the calling thread).
+     */
+    explicit Optimizer(size_t num_threads = 1);
+
+    virtual ~Optimizer() = default;
+
+    /**
+     * @brief Updates the parameters from their gradients and resets the gradients to zero.
+     * @param parameters The flat parameter buffer (e.g. Sequential::parameters()).
+     * @param gradients The matching flat gradient buffer.
+     * @param gradient_scale Factor applied to every gradient, e.g. 1/K after accumulating K samples.
+     * @throws std::invalid_argument if the two buffers have different sizes.
+     */
+    virtual void step(ParameterView parameters, ParameterView gradients, long double gradient_scale = 1.0L) = 0;
+
+    /**
+     * @brief Updates some rows of a table kept outside the flat store, e.g. an embedding table.
+     * Row state (momentum, moments) only advances when a row is updated. The default applies
+     * plain gradient descent at get_learning_rate(); SGD and Adam override it.
+     * @param table The whole table, row-major; its address identifies the table's state.
+     * @param row_size Scalars per row.
+     * @param rows Indices of the rows to update.
+     * @param gradients Gradients of those rows, rows.size() x row_size.
+     * @param gradient_scale Factor applied to every gradient.
+     * @throws std::invalid_argument if the sizes do not match.
+     */
+    virtual void sparse_step(ParameterView table, size_t row_size, const std::vector<size_t>& rows,
+                             const long double* gradients, long double gradient_scale = 1.0L);
+
+    /**
+     * @brief Returns the base learning rate.
+     */
+    virtual long double get_learning_rate() const = 0;
+};
+
+#endif // OPTIMIZER_H
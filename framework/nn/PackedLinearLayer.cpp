@@ -0,0 +1,105 @@
+#include "PackedLinearLayer.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+PackedLinearLayer::PackedLinearLayer(const std::vector<long double>& weights, std::vector<long double> biases,
+                                     size_t input_size, ActivationKind activation)
+    : input_size(input_size), output_size(biases.size()), biases(std::move(biases)), activation(activation) {
+    if (activation == ActivationKind::Custom) {
+        throw std::invalid_argument("Custom activations cannot be fused into a packed layer.");
+    }
+    if (weights.size() != output_size * input_size) {
+        throw std::invalid_argument("Weight count does not match the layer's sizes.");
+    }
+
+    size_t panels = (output_size + PANEL_SIZE - 1) / PANEL_SIZE;
+    packed_weights.assign(panels * input_size * PANEL_SIZE, 0.0L);
+    for (size_t i = 0; i < output_size; ++i) {
+        size_t panel = i / PANEL_SIZE;
+        size_t lane = i % PANEL_SIZE;
+        for (size_t j = 0; j < input_size; ++j) {
+            packed_weights[(panel * input_size + j) * PANEL_SIZE + lane] = weights[i * input_size + j];
+        }
+    }
+}
+
+PackedLinearLayer::PackedLinearLayer(const LinearLayer& layer, ActivationKind activation)
+    : PackedLinearLayer(std::vector<long double>(layer.get_weights().begin(), layer.get_weights().end()),
+                        std::vector<long double>(layer.get_biases().begin(), layer.get_biases().end()),
+                        layer.get_input_size(), activation) {}
+
+std::vector<long double> PackedLinearLayer::forward(const std::vector<long double>& inputs) {
+    return predict(inputs);
+}
+
+std::vector<long double> PackedLinearLayer::predict(const std::vector<long double>& inputs) const {
+    if (inputs.size() != input_size) {
+        throw std::invalid_argument("Input size does not match the layer's input size.");
+    }
+
+    std::vector<long double> outputs(output_size);
+    const long double* x = inputs.data();
+
+    for (size_t first = 0; first < output_size; first += PANEL_SIZE) {
+        long double acc[PANEL_SIZE] = {};
+        size_t lanes = std::min(PANEL_SIZE, output_size - first);
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            acc[lane] = biases[first + lane];
+        }
+
+        const long double* panel = packed_weights.data() + first * input_size;
+        for (size_t j = 0; j < input_size; ++j) {
+            const long double* w = panel + j * PANEL_SIZE;
+            for (size_t lane = 0; lane < PANEL_SIZE; ++lane) {
+                acc[lane] += x[j] * w[lane];
+            }
+        }
+
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            outputs[first + lane] = acc[lane];
+        }
+    }
+
+    switch (activation) {
+        case ActivationKind::ReLU:
+            for (auto& value : outputs) {
+                value = std::max(value, 0.0L);
+            }
+            break;
+        case ActivationKind::Sigmoid:
+            for (auto& value : outputs) {
+                value = 1.0L / (1.0L + std::exp(-value));
+            }
+            break;
+        case ActivationKind::Tanh:
+            for (auto& value : outputs) {
+                value = std::tanh(value);
+            }
+            break;
+        default:
+            break;
+    }
+
+    return outputs;
+}
+
+std::vector<long double> PackedLinearLayer::backward(const std::vector<long double>& gradients) {
+    throw std::logic_error("PackedLinearLayer is inference-only and does not support backward.");
+}
+
+std::shared_ptr<Module> PackedLinearLayer::clone() const {
+    return std::make_shared<PackedLinearLayer>(*this);
+}
+
+size_t PackedLinearLayer::get_input_size() const {
+    return input_size;
+}
+
+size_t PackedLinearLayer::get_output_size() const {
+    return output_size;
+}
+
+ActivationKind PackedLinearLayer::get_activation() const {
+    return activation;
+}
@@ -0,0 +1,97 @@
+#ifndef PACKEDLINEARLAYER_H
+#define PACKEDLINEARLAYER_H
+
+#include "Module.h"
+#include "LinearLayer.h"
+#include "Activations.h"
+#include <vector>
+#include <cstddef>
+
+/**
+ * @class PackedLinearLayer
+ * @brief Inference-only fully connected layer with weights packed for the matvec kernel.
+ *
+ * Output rows are grouped in panels of PANEL_SIZE and stored interleaved per input, so one
+ * sweep over the input updates PANEL_SIZE independent accumulators. Each output is still
+ * accumulated in input order, so results equal LinearLayer::predict. A built-in activation
+ * can be fused into the epilogue.
+ */
+class PackedLinearLayer : public Module {
+private:
+    static constexpr size_t PANEL_SIZE = 4;
+
+    size_t input_size;
+    size_t output_size;
+    std::vector<long double> packed_weights;   // [panel][input][PANEL_SIZE], zero padded
+    std::vector<long double> biases;
+    ActivationKind activation;
+
+public:
+    /**
+     * @brief Packs row-major weights.
+     * @param weights Weights laid out [output][input], as in LinearLayer.
+     * @param biases One bias per output.
+     * @param input_size Number of inputs.
+     * @param activation Activation fused into the epilogue (Identity for none).
+     * @throws std::invalid_argument if the sizes do not agree or the activation is Custom.
+     */
+    PackedLinearLayer(const std::vector<long double>& weights, std::vector<long double> biases,
+                      size_t input_size, ActivationKind activation = ActivationKind::Identity);
+
+    /**
+     * @brief Packs the weights of a trained LinearLayer.
+     * @param layer The layer to pack.
+     * @param activation Activation fused into the epilogue (Identity for none).
+     */
+    explicit PackedLinearLayer(const LinearLayer& layer, ActivationKind activation = ActivationKind::Identity);
+
+    /**
+     * @brief Performs the forward pass.
+     * @param inputs The input tensor.
+     * @return The activated output tensor.
+     */
+    std::vector<long double> forward(const std::vector<long double>& inputs) override;
+
+    /**
+     * @brief Performs the forward pass without caching inputs.
+     * @param inputs The input tensor.
+     * @return The activated output tensor.
+     * @throws std::invalid_argument if the input size does not match.
+     */
+    std::vector<long double> predict(const std::vector<long double>& inputs) const override;
+
+    /**
+     * @brief Not supported, the layer is inference-only.
+     * @throws std::logic_error always.
+     */
+    std::vector<long double> backward(const std::vector<long double>& gradients) override;
+
+    /**
+     * @brief Does nothing, packed weights are frozen.
+     * @param learning_rate Ignored.
+     */
+    void update_parameters(long double learning_rate) override {}
+
+    /**
+     * @brief Creates an independent copy of the layer.
+     * @return The copy.
+     */
+    std::shared_ptr<Module> clone() const override;
+
+    /**
+     * @brief Returns the input size of the layer.
+     */
+    size_t get_input_size() const;
+
+    /**
+     * @brief Returns the output size of the layer.
+     */
+    size_t get_output_size() const;
+
+    /**
+     * @brief Returns the activation fused into the epilogue.
+     */
+    ActivationKind get_activation() const;
+};
+
+#endif // PACKEDLINEARLAYER_H
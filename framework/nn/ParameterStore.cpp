@@ -0,0 +1,32 @@
+#include "ParameterStore.h"
+#include <stdexcept>
+
+ParameterStore::ParameterStore(size_t size)
+    : values(size, 0.0L), gradients(size, 0.0L),
+      value_data(values.data()), gradient_data(gradients.data()), value_count(size), read_only(false) {}
+
+ParameterStore::ParameterStore(const long double* external, size_t size, std::shared_ptr<const void> owner)
+    : value_data(const_cast<long double*>(external)), gradient_data(nullptr), value_count(size),
+      read_only(true), owner(std::move(owner)) {}
+
+bool ParameterStore::is_read_only() const {
+    return read_only;
+}
+
+size_t ParameterStore::size() const {
+    return value_count;
+}
+
+ParameterView ParameterStore::values_view(size_t offset, size_t count) {
+    if (offset + count > value_count) {
+        throw std::out_of_range("Parameter view exceeds the store size.");
+    }
+    return {value_data + offset, count};
+}
+
+ParameterView ParameterStore::gradients_view(size_t offset, size_t count) {
+    if (offset + count > value_count) {
+        throw std::out_of_range("Gradient view exceeds the store size.");
+    }
+    return {gradient_data ? gradient_data + offset : nullptr, count};
+}
@@ -0,0 +1,84 @@
+#ifndef PARAMETERSTORE_H
+#define PARAMETERSTORE_H
+
+#include <vector>
+#include <cstddef>
+#include <memory>
+
+/**
+ * @struct ParameterView
+ * @brief Non-owning view over a contiguous range of a ParameterStore.
+ */
+struct ParameterView {
+    long double* data = nullptr;
+    size_t size = 0;
+
+    long double* begin() const { return data; }
+    long double* end() const { return data + size; }
+    long double& operator[](size_t index) const { return data[index]; }
+};
+
+/**
+ * @class ParameterStore
+ * @brief Contiguous parameter buffer with a matching gradient buffer.
+ *
+ * Modules keep their tensors at fixed offsets inside a store, so a whole model can be
+ * swept, copied or reduced as two flat arrays. The buffers never reallocate.
+ *
+ * A store can also wrap read-only values owned elsewhere (e.g. a shared memory mapping).
+ * Such a store has no gradient buffer, and modules bound to it can only run predict().
+ */
+class ParameterStore {
+private:
+    std::vector<long double> values;
+    std::vector<long double> gradients;
+    long double* value_data;
+    long double* gradient_data;
+    size_t value_count;
+    bool read_only;
+    std::shared_ptr<const void> owner;
+
+public:
+    /**
+     * @brief Allocates zero-initialized parameter and gradient buffers.
+     * @param size Number of scalars in each buffer.
+     */
+    explicit ParameterStore(size_t size);
+
+    /**
+     * @brief Wraps read-only parameter values owned by someone else.
+     * @param external The values; must stay valid and unchanged while owner is alive.
+     * @param size Number of scalars.
+     * @param owner Keeps the memory alive for as long as the store exists.
+     */
+    ParameterStore(const long double* external, size_t size, std::shared_ptr<const void> owner);
+
+    ParameterStore(const ParameterStore&) = delete;
+    ParameterStore& operator=(const ParameterStore&) = delete;
+
+    /**
+     * @brief Checks whether the values are external and read-only.
+     */
+    bool is_read_only() const;
+
+    /**
+     * @brief Returns the number of scalars in each buffer.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns a view of the parameter values.
+     * @param offset First scalar of the view.
+     * @param count Number of scalars in the view.
+     */
+    ParameterView values_view(size_t offset, size_t count);
+
+    /**
+     * @brief Returns a view of the gradients; its data is null for a read-only store.
+     * @param offset First scalar of the view.
+     * @param count Number of scalars in the view.
+     */
+    ParameterView gradients_view(size_t offset, size_t count);
+};
+
+#endif // PARAMETERSTORE_H
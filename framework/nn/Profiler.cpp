@@ -0,0 +1,162 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#ifdef __GNUG__
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+namespace {
+    std::string type_label(const std::type_info* type) {
+        if (!type) {
+            return "";
+        }
+#ifdef __GNUG__
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(type->name(), nullptr, nullptr, &status);
+        if (status == 0 && demangled) {
+            std::string name(demangled);
+            std::free(demangled);
+            return name;
+        }
+#endif
+        return type->name();
+    }
+
+    std::string event_label(const ProfileEvent& event) {
+        if (!event.module_type) {
+            return Profiler::phase_name(event.phase);
+        }
+        return type_label(event.module_type) + "#" + std::to_string(event.module_index);
+    }
+
+    std::string escape_json(const std::string& text) {
+        std::string escaped;
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                escaped += '\\';
+            }
+            escaped += c;
+        }
+        return escaped;
+    }
+}
+
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+void Profiler::set_enabled(bool value) {
+    enabled.store(value, std::memory_order_relaxed);
+}
+
+void Profiler::set_capacity(size_t events) {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    capacity = std::max<size_t>(events, 1);
+}
+
+Profiler::ThreadBuffer& Profiler::local_buffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        buffer->events.resize(capacity);
+        buffer->thread_id = static_cast<uint32_t>(buffers.size());
+        buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void Profiler::record(const ProfileEvent& event) {
+    ThreadBuffer& buffer = local_buffer();
+    uint64_t position = buffer.written.load(std::memory_order_relaxed);
+    buffer.events[position % buffer.events.size()] = event;
+    buffer.written.store(position + 1, std::memory_order_release);
+}
+
+void Profiler::reset() {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (const auto& buffer : buffers) {
+        buffer->written.store(0, std::memory_order_release);
+    }
+}
+
+std::vector<std::pair<uint32_t, ProfileEvent>> Profiler::snapshot() const {
+    std::vector<std::pair<uint32_t, ProfileEvent>> events;
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (const auto& buffer : buffers) {
+        uint64_t written = buffer->written.load(std::memory_order_acquire);
+        uint64_t retained = std::min<uint64_t>(written, buffer->events.size());
+        for (uint64_t k = written - retained; k < written; ++k) {
+            events.emplace_back(buffer->thread_id, buffer->events[k % buffer->events.size()]);
+        }
+    }
+    return events;
+}
+
+std::vector<ProfileSummary> Profiler::summarize() const {
+    using Key = std::tuple<ProfilePhase, const std::type_info*, int32_t>;
+    std::map<Key, ProfileSummary> totals;
+
+    for (const auto& [thread, event] : snapshot()) {
+        Key key{event.phase, event.module_type, event.module_index};
+        auto it = totals.find(key);
+        if (it == totals.end()) {
+            it = totals.emplace(key, ProfileSummary{event_label(event), event.phase, 0, 0.0, 0.0, 0.0}).first;
+        }
+        ProfileSummary& summary = it->second;
+        ++summary.calls;
+        summary.total_ms += event.duration_ns * 1e-6;
+        summary.flops += event.flops;
+        summary.bytes += event.bytes;
+    }
+
+    std::vector<ProfileSummary> summaries;
+    for (auto& [key, summary] : totals) {
+        summaries.push_back(std::move(summary));
+    }
+    std::sort(summaries.begin(), summaries.end(),
+              [](const ProfileSummary& a, const ProfileSummary& b) { return a.total_ms > b.total_ms; });
+    return summaries;
+}
+
+void Profiler::export_chrome_trace(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        throw std::runtime_error("Unable to open trace file: " + path);
+    }
+
+    file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (const auto& [thread, event] : snapshot()) {
+        file << (first ? "" : ",\n")
+             << "{\"name\":\"" << escape_json(event_label(event)) << "\",\"cat\":\"" << phase_name(event.phase)
+             << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread
+             << ",\"ts\":" << event.start_ns / 1000.0 << ",\"dur\":" << event.duration_ns / 1000.0
+             << ",\"args\":{\"flops\":" << event.flops << ",\"bytes\":" << event.bytes << "}}";
+        first = false;
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    if (!file) {
+        throw std::runtime_error("Unable to write trace file: " + path);
+    }
+}
+
+const char* Profiler::phase_name(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::DataFetch: return "data_fetch";
+        case ProfilePhase::Forward: return "forward";
+        case ProfilePhase::Backward: return "backward";
+        case ProfilePhase::Recompute: return "recompute";
+        case ProfilePhase::Loss: return "loss";
+        case ProfilePhase::Update: return "update";
+        case ProfilePhase::Publish: return "publish";
+    }
+    return "unknown";
+}
@@ -0,0 +1,212 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "Module.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+/**
+ * @enum ProfilePhase
+ * @brief The part of a training step a profiling scope measures.
+ */
+enum class ProfilePhase {
+    DataFetch,
+    Forward,
+    Backward,
+    Recompute,
+    Loss,
+    Update,
+    Publish
+};
+
+/**
+ * @struct ProfileEvent
+ * @brief One completed scope, as stored in the per-thread ring buffers.
+ */
+struct ProfileEvent {
+    ProfilePhase phase;
+    const std::type_info* module_type;   ///< nullptr for scopes not tied to a module.
+    int32_t module_index;                ///< Position inside the enclosing Sequential, -1 if none.
+    uint64_t start_ns;
+    uint64_t duration_ns;
+    double flops;
+    double bytes;
+};
+
+/**
+ * @struct ProfileSummary
+ * @brief Aggregated events of one phase of one module.
+ */
+struct ProfileSummary {
+    std::string label;
+    ProfilePhase phase;
+    size_t calls;
+    double total_ms;
+    double flops;
+    double bytes;
+};
+
+/**
+ * @class Profiler
+ * @brief Collects profiling scopes into per-thread ring buffers.
+ *
+ * Scopes are only compiled in when DL_PROFILING is defined (CMake option ENABLE_PROFILING);
+ * otherwise the PROFILE_* macros expand to nothing. Each thread writes its own ring buffer
+ * without locking, overwriting the oldest events when it is full. Summaries and traces read
+ * the retained events and are exact when called while no instrumented code is running.
+ */
+class Profiler {
+private:
+    struct ThreadBuffer {
+        std::vector<ProfileEvent> events;
+        std::atomic<uint64_t> written{0};
+        uint32_t thread_id;
+    };
+
+    std::atomic<bool> enabled{true};
+    size_t capacity = 1 << 16;
+    std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+    mutable std::mutex registry_mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+    Profiler() = default;
+
+    /**
+     * @brief Returns the calling thread's buffer, registering it on first use.
+     */
+    ThreadBuffer& local_buffer();
+
+    /**
+     * @brief Copies the retained events of every thread.
+     * @return Pairs of thread id and event.
+     */
+    std::vector<std::pair<uint32_t, ProfileEvent>> snapshot() const;
+
+public:
+    /**
+     * @brief Returns the process-wide profiler.
+     */
+    static Profiler& instance();
+
+    /**
+     * @brief Enables or disables recording at runtime (compiled-in scopes still check a flag).
+     */
+    void set_enabled(bool value);
+
+    /**
+     * @brief Checks whether scopes are recorded.
+     */
+    bool is_enabled() const {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Sets the number of events each thread retains; applies to threads that record
+     * their first event afterwards.
+     */
+    void set_capacity(size_t events);
+
+    /**
+     * @brief Returns nanoseconds since the profiler was created.
+     */
+    uint64_t now() const {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - origin).count());
+    }
+
+    /**
+     * @brief Appends an event to the calling thread's ring buffer.
+     */
+    void record(const ProfileEvent& event);
+
+    /**
+     * @brief Drops all retained events.
+     */
+    void reset();
+
+    /**
+     * @brief Aggregates the retained events per phase and module, slowest first.
+     */
+    std::vector<ProfileSummary> summarize() const;
+
+    /**
+     * @brief Writes the retained events in Chrome trace-event format (chrome://tracing, Perfetto).
+     * @param path Destination file.
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    void export_chrome_trace(const std::string& path) const;
+
+    /**
+     * @brief Returns the display name of a phase.
+     */
+    static const char* phase_name(ProfilePhase phase);
+};
+
+/**
+ * @class ProfileScope
+ * @brief Records the lifetime of a block as one ProfileEvent.
+ */
+class ProfileScope {
+private:
+    ProfileEvent event;
+    bool active;
+
+public:
+    /**
+     * @brief Starts a scope not tied to a module.
+     * @param phase The phase being measured.
+     */
+    explicit ProfileScope(ProfilePhase phase)
+        : event{phase, nullptr, -1, 0, 0, 0.0, 0.0}, active(Profiler::instance().is_enabled()) {
+        if (active) {
+            event.start_ns = Profiler::instance().now();
+        }
+    }
+
+    /**
+     * @brief Starts a scope around one call of a module; FLOPs and bytes come from the module's cost.
+     * @param phase The phase being measured.
+     * @param module The module being called.
+     * @param index The module's position inside its Sequential.
+     */
+    ProfileScope(ProfilePhase phase, const Module& module, size_t index)
+        : event{phase, nullptr, static_cast<int32_t>(index), 0, 0, 0.0, 0.0},
+          active(Profiler::instance().is_enabled()) {
+        if (active) {
+            event.module_type = &typeid(module);
+            double factor = phase == ProfilePhase::Backward ? 2.0 : 1.0;
+            event.flops = factor * module.forward_flops();
+            event.bytes = factor * module.forward_bytes();
+            event.start_ns = Profiler::instance().now();
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    ~ProfileScope() {
+        if (active) {
+            event.duration_ns = Profiler::instance().now() - event.start_ns;
+            Profiler::instance().record(event);
+        }
+    }
+};
+
+#ifdef DL_PROFILING
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(phase) ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__)(phase)
+#define PROFILE_MODULE_SCOPE(phase, module, index) \
+    ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__)(phase, module, index)
+#else
+#define PROFILE_SCOPE(phase) ((void)0)
+#define PROFILE_MODULE_SCOPE(phase, module, index) ((void)0)
+#endif
+
+#endif // PROFILER_H
@@ -0,0 +1,122 @@
+#include "QuantizedLinearLayer.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    constexpr float QUANTIZED_MAX = 127.0f;
+
+    float scale_for_range(long double range) {
+        return range > 0.0L ? static_cast<float>(range) / QUANTIZED_MAX : 1.0f;
+    }
+}
+
+QuantizedLinearLayer::QuantizedLinearLayer(const LinearLayer& layer, long double input_range,
+                                           ActivationKind activation)
+    : input_size(layer.get_input_size()), output_size(layer.get_output_size()),
+      input_scale(scale_for_range(input_range)), activation(activation) {
+    if (activation == ActivationKind::Custom) {
+        throw std::invalid_argument("Custom activations cannot be fused into a quantized layer.");
+    }
+
+    ParameterView float_weights = layer.get_weights();
+    ParameterView float_biases = layer.get_biases();
+
+    weights.resize(output_size * input_size);
+    output_scales.resize(output_size);
+    biases.resize(output_size);
+
+    for (size_t i = 0; i < output_size; ++i) {
+        const long double* row = float_weights.data + i * input_size;
+        long double range = 0.0L;
+        for (size_t j = 0; j < input_size; ++j) {
+            range = std::max(range, std::fabs(row[j]));
+        }
+
+        float weight_scale = scale_for_range(range);
+        for (size_t j = 0; j < input_size; ++j) {
+            float q = std::round(static_cast<float>(row[j]) / weight_scale);
+            weights[i * input_size + j] = static_cast<int8_t>(std::clamp(q, -QUANTIZED_MAX, QUANTIZED_MAX));
+        }
+
+        output_scales[i] = weight_scale * input_scale;
+        biases[i] = static_cast<float>(float_biases[i]);
+    }
+}
+
+std::vector<long double> QuantizedLinearLayer::forward(const std::vector<long double>& inputs) {
+    return predict(inputs);
+}
+
+std::vector<long double> QuantizedLinearLayer::predict(const std::vector<long double>& inputs) const {
+    if (inputs.size() != input_size) {
+        throw std::invalid_argument("Input size does not match the layer's input size.");
+    }
+
+    std::vector<int8_t> quantized_inputs(input_size);
+    std::vector<int32_t> accumulators(output_size);
+    std::vector<float> outputs(output_size);
+
+    const float inverse_scale = 1.0f / input_scale;
+    for (size_t j = 0; j < input_size; ++j) {
+        float v = static_cast<float>(inputs[j]) * inverse_scale;
+        v = std::clamp(v, -QUANTIZED_MAX, QUANTIZED_MAX);
+        quantized_inputs[j] = static_cast<int8_t>(v >= 0.0f ? v + 0.5f : v - 0.5f);
+    }
+
+    const int8_t* q_inputs = quantized_inputs.data();
+    for (size_t i = 0; i < output_size; ++i) {
+        const int8_t* row = weights.data() + i * input_size;
+        int32_t acc = 0;
+        for (size_t j = 0; j < input_size; ++j) {
+            acc += static_cast<int32_t>(row[j]) * static_cast<int32_t>(q_inputs[j]);
+        }
+        accumulators[i] = acc;
+    }
+
+    // dequantize, add the bias and apply the activation; one branch-free loop per kind
+    float* out = outputs.data();
+    for (size_t i = 0; i < output_size; ++i) {
+        out[i] = static_cast<float>(accumulators[i]) * output_scales[i] + biases[i];
+    }
+    switch (activation) {
+        case ActivationKind::ReLU:
+            for (size_t i = 0; i < output_size; ++i) {
+                out[i] = std::max(out[i], 0.0f);
+            }
+            break;
+        case ActivationKind::Sigmoid:
+            for (size_t i = 0; i < output_size; ++i) {
+                out[i] = 1.0f / (1.0f + std::exp(-out[i]));
+            }
+            break;
+        case ActivationKind::Tanh:
+            for (size_t i = 0; i < output_size; ++i) {
+                out[i] = std::tanh(out[i]);
+            }
+            break;
+        default:
+            break;
+    }
+
+    return std::vector<long double>(outputs.begin(), outputs.end());
+}
+
+std::vector<long double> QuantizedLinearLayer::backward(const std::vector<long double>& gradients) {
+    throw std::logic_error("QuantizedLinearLayer is inference-only and does not support backward.");
+}
+
+std::shared_ptr<Module> QuantizedLinearLayer::clone() const {
+    return std::make_shared<QuantizedLinearLayer>(*this);
+}
+
+ActivationKind QuantizedLinearLayer::get_activation() const {
+    return activation;
+}
+
+size_t QuantizedLinearLayer::weight_bytes() const {
+    return weights.size() * sizeof(int8_t)
+        + output_scales.size() * sizeof(float)
+        + biases.size() * sizeof(float)
+        + sizeof(input_scale);
+}
@@ -0,0 +1,85 @@
+#ifndef QUANTIZEDLINEARLAYER_H
+#define QUANTIZEDLINEARLAYER_H
+
+#include "Module.h"
+#include "LinearLayer.h"
+#include "Activations.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class QuantizedLinearLayer
+ * @brief Inference-only int8 fully connected layer.
+ *
+ * Weights are quantized symmetrically per output channel, inputs per tensor using a
+ * calibrated range. Products are accumulated in int32 and the dequantization is fused
+ * with the bias and the following activation in a single float epilogue.
+ */
+class QuantizedLinearLayer : public Module {
+private:
+    size_t input_size;
+    size_t output_size;
+
+    std::vector<int8_t> weights;
+    std::vector<float> output_scales;
+    std::vector<float> biases;
+    float input_scale;
+    ActivationKind activation;
+
+public:
+    /**
+     * @brief Quantizes a trained LinearLayer.
+     * @param layer The float layer to quantize.
+     * @param input_range Largest absolute input value observed during calibration.
+     * @param activation Activation fused into the epilogue (Identity for none).
+     * @throws std::invalid_argument if the activation is ActivationKind::Custom.
+     */
+    QuantizedLinearLayer(const LinearLayer& layer, long double input_range,
+                         ActivationKind activation = ActivationKind::Identity);
+
+    /**
+     * @brief Performs the quantized forward pass.
+     * @param inputs The input tensor.
+     * @return The dequantized, activated output tensor.
+     * @throws std::invalid_argument if the input size does not match.
+     */
+    std::vector<long double> forward(const std::vector<long double>& inputs) override;
+
+    /**
+     * @brief Performs the forward pass without caching inputs.
+     * @param inputs The input tensor.
+     * @return The output tensor.
+     */
+    std::vector<long double> predict(const std::vector<long double>& inputs) const override;
+
+    /**
+     * @brief Not supported, the layer is inference-only.
+     * @throws std::logic_error always.
+     */
+    std::vector<long double> backward(const std::vector<long double>& gradients) override;
+
+    /**
+     * @brief Does nothing, quantized weights are frozen.
+     * @param learning_rate Ignored.
+     */
+    void update_parameters(long double learning_rate) override {}
+
+    /**
+     * @brief Creates an independent copy of the layer.
+     * @return The copy.
+     */
+    std::shared_ptr<Module> clone() const override;
+
+    /**
+     * @brief Returns the activation fused into the epilogue.
+     */
+    ActivationKind get_activation() const;
+
+    /**
+     * @brief Returns how many bytes the weights, scales and biases occupy.
+     */
+    size_t weight_bytes() const;
+};
+
+#endif // QUANTIZEDLINEARLAYER_H
@@ -0,0 +1,74 @@
+#include "SGD.h"
+#include <stdexcept>
+
+SGD::SGD(long double learning_rate, long double momentum, bool nesterov,
+         long double weight_decay, size_t num_threads)
+    : Optimizer(num_threads), learning_rate(learning_rate), momentum(momentum),
+      weight_decay(weight_decay), nesterov(nesterov) {}
+
+void SGD::step(ParameterView parameters, ParameterView gradients, long double gradient_scale) {
+    if (parameters.size != gradients.size) {
+        throw std::invalid_argument("Parameters and gradients must have the same size.");
+    }
+    if (momentum != 0.0L && velocity.size() != parameters.size) {
+        velocity.assign(parameters.size, 0.0L);
+    }
+
+    long double* p = parameters.data;
+    long double* g = gradients.data;
+    long double* v = velocity.data();
+
+    if (momentum == 0.0L) {
+        parallel_for(parameters.size, [=](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                p[i] -= learning_rate * (gradient_scale * g[i] + weight_decay * p[i]);
+                g[i] = 0.0L;
+            }
+        });
+        return;
+    }
+
+    // Nesterov steps along grad + momentum * v instead of v, written branch-free
+    const long double gradient_factor = nesterov ? 1.0L : 0.0L;
+    const long double velocity_factor = nesterov ? momentum : 1.0L;
+    parallel_for(parameters.size, [=](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            long double grad = gradient_scale * g[i] + weight_decay * p[i];
+            v[i] = momentum * v[i] + grad;
+            p[i] -= learning_rate * (gradient_factor * grad + velocity_factor * v[i]);
+            g[i] = 0.0L;
+        }
+    });
+}
+
+void SGD::sparse_step(ParameterView table, size_t row_size, const std::vector<size_t>& rows,
+                      const long double* gradients, long double gradient_scale) {
+    SparseRowState* state = momentum != 0.0L ? &sparse_state(table, row_size) : nullptr;
+    const long double gradient_factor = nesterov ? 1.0L : 0.0L;
+    const long double velocity_factor = nesterov ? momentum : 1.0L;
+
+    for (size_t r = 0; r < rows.size(); ++r) {
+        if (row_size == 0 || (rows[r] + 1) * row_size > table.size) {
+            throw std::invalid_argument("Sparse row is outside the table.");
+        }
+        long double* p = table.data + rows[r] * row_size;
+        const long double* g = gradients + r * row_size;
+
+        if (!state) {
+            for (size_t d = 0; d < row_size; ++d) {
+                p[d] -= learning_rate * (gradient_scale * g[d] + weight_decay * p[d]);
+            }
+            continue;
+        }
+        long double* v = state->get(rows[r]);
+        for (size_t d = 0; d < row_size; ++d) {
+            long double grad = gradient_scale * g[d] + weight_decay * p[d];
+            v[d] = momentum * v[d] + grad;
+            p[d] -= learning_rate * (gradient_factor * grad + velocity_factor * v[d]);
+        }
+    }
+}
+
+long double SGD::get_learning_rate() const {
+    return learning_rate;
+}
@@ -0,0 +1,57 @@
+#ifndef SGD_H
+#define SGD_H
+
+#include "Optimizer.h"
+#include <vector>
+
+/**
+ * @class SGD
+ * @brief Stochastic gradient descent with optional (Nesterov) momentum and weight decay.
+ */
+class SGD : public Optimizer {
+private:
+    long double learning_rate;
+    long double momentum;
+    long double weight_decay;
+    bool nesterov;
+    std::vector<long double> velocity;
+
+public:
+    /**
+     * @brief Constructor for SGD.
+     * @param learning_rate The learning rate.
+     * @param momentum Momentum factor (0 for plain gradient descent).
+     * @param nesterov Whether to use Nesterov momentum.
+     * @param weight_decay L2 penalty added to the gradients.
+     * @param num_threads Number of threads used by a step.
+     */
+    explicit SGD(long double learning_rate, long double momentum = 0.0L, bool nesterov = false,
+                 long double weight_decay = 0.0L, size_t num_threads = 1);
+
+    /**
+     * @brief Applies one SGD update and resets the gradients.
+     * @param parameters The flat parameter buffer.
+     * @param gradients The matching flat gradient buffer.
+     * @param gradient_scale Factor applied to every gradient.
+     */
+    void step(ParameterView parameters, ParameterView gradients, long double gradient_scale = 1.0L) override;
+
+    /**
+     * @brief Applies the same update to some rows of an out-of-store table.
+     * Each row has its own velocity, which decays only when the row is updated.
+     * @param table The whole table, row-major.
+     * @param row_size Scalars per row.
+     * @param rows Indices of the rows to update.
+     * @param gradients Gradients of those rows, rows.size() x row_size.
+     * @param gradient_scale Factor applied to every gradient.
+     */
+    void sparse_step(ParameterView table, size_t row_size, const std::vector<size_t>& rows,
+                     const long double* gradients, long double gradient_scale = 1.0L) override;
+
+    /**
+     * @brief Returns the learning rate.
+     */
+    long double get_learning_rate() const override;
+};
+
+#endif // SGD_H
@@ -1,27 +1,251 @@
 #include "SequentialNN.h"
+#include "Profiler.h"
+#include <algorithm>
 
 void Sequential::add_module(const std::shared_ptr<Module>& module) {
     modules.push_back(module);
+    bind_parameters(std::make_shared<ParameterStore>(parameter_count()), 0);
+}
+
+void Sequential::set_checkpoints(std::vector<size_t> boundaries) {
+    std::sort(boundaries.begin(), boundaries.end());
+    boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+    checkpoint_boundaries = std::move(boundaries);
+}
+
+void Sequential::set_checkpoint_interval(size_t segment_length) {
+    std::vector<size_t> boundaries;
+    if (segment_length > 0) {
+        for (size_t m = segment_length; m < modules.size(); m += segment_length) {
+            boundaries.push_back(m);
+        }
+        boundaries.push_back(0);  // keeps checkpointing on for models shorter than one segment
+    }
+    set_checkpoints(std::move(boundaries));
+}
+
+std::vector<long double> Sequential::forward_checkpointed(size_t first, const std::vector<long double>& inputs) {
+    segment_starts.clear();
+    segment_inputs.clear();
+    first_checkpointed = first;
+
+    std::vector<long double> output = inputs;
+    for (size_t m = first; m < modules.size(); ++m) {
+        if (m == first || std::binary_search(checkpoint_boundaries.begin(), checkpoint_boundaries.end(), m)) {
+            segment_starts.push_back(m);
+            segment_inputs.push_back(output);
+        }
+        PROFILE_MODULE_SCOPE(ProfilePhase::Forward, *modules[m], m);
+        output = modules[m]->predict(output);
+    }
+    return output;
+}
+
+std::vector<long double> Sequential::backward_checkpointed(const std::vector<long double>& gradients) {
+    std::vector<long double> output_gradients = gradients;
+
+    for (size_t s = segment_starts.size(); s-- > 0;) {
+        size_t begin = segment_starts[s];
+        size_t end = s + 1 < segment_starts.size() ? segment_starts[s + 1] : modules.size();
+
+        std::vector<long double> activations = std::move(segment_inputs[s]);
+        for (size_t m = begin; m < end; ++m) {
+            PROFILE_MODULE_SCOPE(ProfilePhase::Recompute, *modules[m], m);
+            activations = modules[m]->forward(activations);
+        }
+        for (size_t m = end; m-- > begin;) {
+            output_gradients = backward_module(m, output_gradients);
+            modules[m]->release_cache();
+        }
+    }
+
+    segment_starts.clear();
+    segment_inputs.clear();
+    return output_gradients;
 }
 
 std::vector<long double> Sequential::forward(const std::vector<long double>& inputs) {
+    if (!checkpoint_boundaries.empty()) {
+        return forward_checkpointed(0, inputs);
+    }
+
+    std::vector<long double> output = inputs;
+    for (size_t m = 0; m < modules.size(); ++m) {
+        PROFILE_MODULE_SCOPE(ProfilePhase::Forward, *modules[m], m);
+        output = modules[m]->forward(output);
+    }
+    return output;
+}
+
+std::vector<long double> Sequential::predict(const std::vector<long double>& inputs) const {
     std::vector<long double> output = inputs;
     for (const auto& module : modules) {
-        output = module->forward(output);
+        output = module->predict(output);
+    }
+    return output;
+}
+
+std::vector<long double> Sequential::forward_sparse(const SparseRow& inputs) {
+    if (modules.empty()) {
+        throw std::logic_error("Cannot run a sparse input through an empty Sequential.");
+    }
+
+    std::vector<long double> output;
+    {
+        PROFILE_MODULE_SCOPE(ProfilePhase::Forward, *modules.front(), 0);
+        output = modules.front()->forward_sparse(inputs);
+    }
+    if (!checkpoint_boundaries.empty()) {
+        // the sparse row is not copied; the first module keeps its own cache
+        return forward_checkpointed(1, output);
+    }
+
+    for (size_t m = 1; m < modules.size(); ++m) {
+        PROFILE_MODULE_SCOPE(ProfilePhase::Forward, *modules[m], m);
+        output = modules[m]->forward(output);
+    }
+    return output;
+}
+
+std::vector<long double> Sequential::predict_sparse(const SparseRow& inputs) const {
+    if (modules.empty()) {
+        throw std::logic_error("Cannot run a sparse input through an empty Sequential.");
+    }
+
+    std::vector<long double> output = modules.front()->predict_sparse(inputs);
+    for (size_t m = 1; m < modules.size(); ++m) {
+        output = modules[m]->predict(output);
     }
     return output;
 }
 
 std::vector<long double> Sequential::backward(const std::vector<long double>& gradients) {
+    if (!checkpoint_boundaries.empty()) {
+        std::vector<long double> output_gradients = backward_checkpointed(gradients);
+        for (size_t m = first_checkpointed; m-- > 0;) {
+            output_gradients = backward_module(m, output_gradients);
+        }
+        return output_gradients;
+    }
+
     std::vector<long double> output_gradients = gradients;
-    for (auto it = modules.rbegin(); it != modules.rend(); ++it) {
-        output_gradients = (*it)->backward(output_gradients);
+    for (size_t m = modules.size(); m-- > 0;) {
+        output_gradients = backward_module(m, output_gradients);
     }
     return output_gradients;
 }
 
+std::vector<long double> Sequential::backward_module(size_t m, const std::vector<long double>& gradients) {
+    std::vector<long double> input_gradients;
+    {
+        PROFILE_MODULE_SCOPE(ProfilePhase::Backward, *modules[m], m);
+        input_gradients = modules[m]->backward(gradients);
+    }
+    if (gradient_hook) {
+        gradient_hook(m);
+    }
+    return input_gradients;
+}
+
+void Sequential::set_gradient_hook(std::function<void(size_t)> hook) {
+    gradient_hook = std::move(hook);
+}
+
+double Sequential::forward_flops() const {
+    double flops = 0.0;
+    for (const auto& module : modules) {
+        flops += module->forward_flops();
+    }
+    return flops;
+}
+
+double Sequential::forward_bytes() const {
+    double bytes = 0.0;
+    for (const auto& module : modules) {
+        bytes += module->forward_bytes();
+    }
+    return bytes;
+}
+
+void Sequential::refresh_parameters() {
+    for (const auto& module : modules) {
+        module->refresh_parameters();
+    }
+}
+
+void Sequential::release_cache() {
+    for (const auto& module : modules) {
+        module->release_cache();
+    }
+    segment_starts.clear();
+    segment_inputs.clear();
+}
+
 void Sequential::update_parameters(long double learning_rate) {
-    for (auto& module : modules) {
-        module->update_parameters(learning_rate);
+    Module::update_parameters(learning_rate);
+    update_sparse_parameters(learning_rate);
+    refresh_parameters();
+}
+
+void Sequential::update_sparse_parameters(long double learning_rate, long double gradient_scale) {
+    for (const auto& module : modules) {
+        module->update_sparse_parameters(learning_rate, gradient_scale);
     }
 }
+
+void Sequential::step_sparse_parameters(Optimizer& optimizer, long double gradient_scale) {
+    for (const auto& module : modules) {
+        module->step_sparse_parameters(optimizer, gradient_scale);
+    }
+}
+
+void Sequential::copy_parameters_from(const Module& source) {
+    const auto* other = dynamic_cast<const Sequential*>(&source);
+    if (!other || other->modules.size() != modules.size()) {
+        throw std::invalid_argument("Source is not a Sequential of the same length.");
+    }
+    for (size_t i = 0; i < modules.size(); ++i) {
+        modules[i]->copy_parameters_from(*other->modules[i]);
+    }
+}
+
+size_t Sequential::parameter_count() const {
+    size_t count = 0;
+    for (const auto& module : modules) {
+        count += module->parameter_count();
+    }
+    return count;
+}
+
+bool Sequential::has_sparse_parameters() const {
+    return std::any_of(modules.begin(), modules.end(),
+                       [](const auto& module) { return module->has_sparse_parameters(); });
+}
+
+bool Sequential::sparse_gradients_finite() const {
+    return std::all_of(modules.begin(), modules.end(),
+                       [](const auto& module) { return module->sparse_gradients_finite(); });
+}
+
+void Sequential::bind_parameters(const std::shared_ptr<ParameterStore>& store, size_t offset) {
+    size_t module_offset = offset;
+    for (const auto& module : modules) {
+        module->bind_parameters(store, module_offset);
+        module_offset += module->parameter_count();
+    }
+    parameter_store = store;
+    parameter_offset = offset;
+}
+
+std::shared_ptr<Module> Sequential::clone() const {
+    auto copy = std::make_shared<Sequential>();
+    for (const auto& module : modules) {
+        copy->add_module(module->clone());
+    }
+    copy->checkpoint_boundaries = checkpoint_boundaries;
+    return copy;
+}
+
+const std::vector<std::shared_ptr<Module>>& Sequential::get_modules() const {
+    return modules;
+}
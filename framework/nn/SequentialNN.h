@@ -4,6 +4,7 @@
 #include "Module.h"
 #include <vector>
 #include <memory>
+#include <functional>
 
 /**
  * @class Sequential
@@ -13,13 +14,67 @@ class Sequential : public Module {
 private:
     std::vector<std::shared_ptr<Module>> modules;
 
+    std::vector<size_t> checkpoint_boundaries;
+    std::vector<size_t> segment_starts;
+    std::vector<std::vector<long double>> segment_inputs;
+    size_t first_checkpointed = 0;
+
+    std::function<void(size_t)> gradient_hook;
+
+    /**
+     * @brief Runs backward through one module and reports its gradients as complete.
+     */
+    std::vector<long double> backward_module(size_t m, const std::vector<long double>& gradients);
+
+    /**
+     * @brief Runs modules[first..] keeping only the input of every segment.
+     * @param first Index of the first module to run.
+     * @param inputs The input of modules[first].
+     * @return The output of the last module.
+     */
+    std::vector<long double> forward_checkpointed(size_t first, const std::vector<long double>& inputs);
+
+    /**
+     * @brief Recomputes each segment from its input and backpropagates through it, last first.
+     * @param gradients The gradient of the loss with respect to the output.
+     * @return The gradient of the loss with respect to the input of modules[first_checkpointed].
+     */
+    std::vector<long double> backward_checkpointed(const std::vector<long double>& gradients);
+
 public:
     /**
      * @brief Adds a module to the sequence.
+     * The parameters of every module are re-registered into one model-wide store.
+     * Modules should be added before this Sequential is nested in another one.
      * @param module A shared pointer to the module to add.
      */
     void add_module(const std::shared_ptr<Module>& module);
 
+    /**
+     * @brief Enables activation checkpointing.
+     * A segment starts at module 0 and at every listed module index. During forward only the
+     * input of each segment is kept and interior modules run through predict(); backward
+     * recomputes one segment at a time and releases its caches before moving to the previous
+     * one. Modules must compute the same output in predict() and forward().
+     * @param boundaries Module indices starting a segment; an empty list disables checkpointing.
+     */
+    void set_checkpoints(std::vector<size_t> boundaries);
+
+    /**
+     * @brief Enables checkpointing with a segment every segment_length modules.
+     * @param segment_length Modules per segment; 0 disables checkpointing.
+     */
+    void set_checkpoint_interval(size_t segment_length);
+
+    /**
+     * @brief Registers a callback invoked during backward as soon as a module's gradients
+     * for the current sample are complete, i.e. right after its backward pass. Modules are
+     * reported from last to first, so data-parallel training can start reducing the
+     * gradients of later layers while earlier layers are still being backpropagated.
+     * @param hook Receives the module index; an empty function removes the hook.
+     */
+    void set_gradient_hook(std::function<void(size_t)> hook);
+
     /**
      * @brief Performs the forward pass through all modules in sequence.
      * @param inputs The input tensor.
@@ -27,6 +82,27 @@ public:
      */
     std::vector<long double> forward(const std::vector<long double>& inputs) override;
 
+    /**
+     * @brief Performs the forward pass without caching inputs.
+     * @param inputs The input tensor.
+     * @return The output tensor.
+     */
+    std::vector<long double> predict(const std::vector<long double>& inputs) const override;
+
+    /**
+     * @brief Performs the forward pass with a sparse input, which the first module must accept.
+     * @param inputs The sparse input row.
+     * @return The output tensor after passing through all modules.
+     */
+    std::vector<long double> forward_sparse(const SparseRow& inputs) override;
+
+    /**
+     * @brief Performs the sparse forward pass without caching inputs.
+     * @param inputs The sparse input row.
+     * @return The output tensor after passing through all modules.
+     */
+    std::vector<long double> predict_sparse(const SparseRow& inputs) const override;
+
     /**
      * @brief Performs the backward pass through all modules in reverse sequence.
      * @param gradients The gradient of the loss with respect to the output.
@@ -35,10 +111,85 @@ public:
     std::vector<long double> backward(const std::vector<long double>& gradients) override;
 
     /**
-     * @brief Updates the parameters of all modules in the sequence.
+     * @brief Returns the summed forward FLOPs of all modules.
+     */
+    double forward_flops() const override;
+
+    /**
+     * @brief Returns the summed forward bytes of all modules.
+     */
+    double forward_bytes() const override;
+
+    /**
+     * @brief Notifies every module that the parameter values changed.
+     */
+    void refresh_parameters() override;
+
+    /**
+     * @brief Frees the forward state of every module.
+     */
+    void release_cache() override;
+
+    /**
+     * @brief Updates the parameters of all modules in one sweep over the model's store.
      * @param learning_rate The learning rate for gradient descent.
      */
     void update_parameters(long double learning_rate) override;
+
+    /**
+     * @brief Applies the pending out-of-store updates of every module.
+     * @param learning_rate The learning rate for gradient descent.
+     * @param gradient_scale Factor applied to the accumulated gradients.
+     */
+    void update_sparse_parameters(long double learning_rate, long double gradient_scale = 1.0L) override;
+
+    /**
+     * @brief Applies the pending out-of-store updates of every module with an optimizer.
+     * @param optimizer The optimizer stepping the flat store.
+     * @param gradient_scale Factor applied to the accumulated gradients.
+     */
+    void step_sparse_parameters(Optimizer& optimizer, long double gradient_scale = 1.0L) override;
+
+    /**
+     * @brief Copies the parameters of a Sequential with the same topology, module by module.
+     * @param source The Sequential to copy from.
+     * @throws std::invalid_argument if source is not a Sequential of the same length.
+     */
+    void copy_parameters_from(const Module& source) override;
+
+    /**
+     * @brief Returns the total parameter count of all modules.
+     */
+    size_t parameter_count() const override;
+
+    /**
+     * @brief Returns whether any module has parameters outside the flat store.
+     */
+    bool has_sparse_parameters() const override;
+
+    /**
+     * @brief Returns whether every module's pending out-of-store gradients are finite.
+     */
+    bool sparse_gradients_finite() const override;
+
+    /**
+     * @brief Registers every module's parameters, in module order, into a store.
+     * @param store The store to register into.
+     * @param offset Position of the first module's parameters inside the store.
+     */
+    void bind_parameters(const std::shared_ptr<ParameterStore>& store, size_t offset) override;
+
+    /**
+     * @brief Creates a deep copy of the sequence with its own parameter store.
+     * @return The copy, holding the current parameter values.
+     */
+    std::shared_ptr<Module> clone() const override;
+
+    /**
+     * @brief Returns the modules in the sequence, in forward order.
+     * @return A const reference to the module list.
+     */
+    const std::vector<std::shared_ptr<Module>>& get_modules() const;
 };
 
 #endif // SEQUENTIAL_H
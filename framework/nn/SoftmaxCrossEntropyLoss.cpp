@@ -0,0 +1,81 @@
+#include "SoftmaxCrossEntropyLoss.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    size_t class_index(long double target, size_t output_size) {
+        if (target < 0.0L || target >= static_cast<long double>(output_size) || target != std::floor(target)) {
+            throw std::invalid_argument("Target class index is not a valid class.");
+        }
+        return static_cast<size_t>(target);
+    }
+}
+
+long double SoftmaxCrossEntropyLoss::compute_loss(
+    const std::vector<long double>& predictions,
+    const std::vector<long double>& targets
+) const {
+    if (targets.size() != 1) {
+        throw std::invalid_argument("Softmax cross-entropy expects a single class index per sample.");
+    }
+
+    return compute_loss_and_gradient(predictions.data(), targets.data(), nullptr, 1, predictions.size());
+}
+
+long double SoftmaxCrossEntropyLoss::compute_loss_and_gradient(
+    const long double* predictions,
+    const long double* targets,
+    long double* gradients,
+    size_t batch_size,
+    size_t output_size
+) const {
+    long double loss = 0.0L;
+
+    for (size_t n = 0; n < batch_size; ++n) {
+        const long double* logits = predictions + n * output_size;
+        size_t target = class_index(targets[n], output_size);
+
+        long double max_logit = *std::max_element(logits, logits + output_size);
+
+        long double sum = 0.0L;
+        if (gradients) {
+            // exponentials are staged in the gradient row and normalized in place
+            long double* row = gradients + n * output_size;
+            for (size_t k = 0; k < output_size; ++k) {
+                row[k] = std::exp(logits[k] - max_logit);
+                sum += row[k];
+            }
+            const long double inverse_sum = 1.0L / sum;
+            for (size_t k = 0; k < output_size; ++k) {
+                row[k] *= inverse_sum;
+            }
+            row[target] -= 1.0L;
+        } else {
+            for (size_t k = 0; k < output_size; ++k) {
+                sum += std::exp(logits[k] - max_logit);
+            }
+        }
+
+        loss += std::log(sum) + max_logit - logits[target];
+    }
+
+    return loss;
+}
+
+size_t SoftmaxCrossEntropyLoss::predicted_class(const long double* prediction, size_t output_size) const {
+    return std::max_element(prediction, prediction + output_size) - prediction;
+}
+
+long double SoftmaxCrossEntropyLoss::positive_score(const long double* prediction, size_t output_size) const {
+    if (output_size < 2) {
+        return 0.0L;
+    }
+
+    long double max_logit = *std::max_element(prediction, prediction + output_size);
+    long double sum = 0.0L;
+    for (size_t k = 0; k < output_size; ++k) {
+        sum += std::exp(prediction[k] - max_logit);
+    }
+    return std::exp(prediction[1] - max_logit) / sum;
+}
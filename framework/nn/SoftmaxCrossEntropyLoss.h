@@ -0,0 +1,57 @@
+#ifndef SOFTMAX_CROSS_ENTROPY_LOSS_H
+#define SOFTMAX_CROSS_ENTROPY_LOSS_H
+
+#include "LossFunction.h"
+#include <vector>
+
+/**
+ * @class SoftmaxCrossEntropyLoss
+ * @brief Multi-class cross-entropy computed directly from logits.
+ *
+ * The model's last layer outputs one logit per class, with no activation after it.
+ * Targets hold a single integer class index per sample, as read from a target DataFrame column.
+ * Softmax, loss and gradient are computed together with the max-subtraction trick.
+ */
+class SoftmaxCrossEntropyLoss : public LossFunction {
+public:
+    /**
+     * @brief Computes the loss of one sample.
+     * @param predictions The logits, one per class.
+     * @param targets A single element holding the class index.
+     * @return The computed loss value.
+     * @throws std::invalid_argument if targets does not hold exactly one element.
+     */
+    long double compute_loss(const std::vector<long double>& predictions, const std::vector<long double>& targets) const override;
+
+    /**
+     * @brief Computes the batch loss and its gradient with respect to the logits.
+     * @param predictions Logits, batch_size x output_size.
+     * @param targets One class index per sample.
+     * @param gradients Receives softmax - one_hot(target), or nullptr.
+     * @param batch_size Number of samples in the batch.
+     * @param output_size Number of classes.
+     * @return The sum of the per-sample losses.
+     * @throws std::invalid_argument if a class index is out of range.
+     */
+    long double compute_loss_and_gradient(const long double* predictions, const long double* targets,
+                                          long double* gradients, size_t batch_size,
+                                          size_t output_size) const override;
+
+    /**
+     * @brief Returns the class with the largest logit.
+     * @param prediction The logits for one sample.
+     * @param output_size Number of classes.
+     * @return The argmax of the logits.
+     */
+    size_t predicted_class(const long double* prediction, size_t output_size) const override;
+
+    /**
+     * @brief Returns the softmax probability of class 1.
+     * @param prediction The logits for one sample.
+     * @param output_size Number of classes.
+     * @return The probability of class 1.
+     */
+    long double positive_score(const long double* prediction, size_t output_size) const override;
+};
+
+#endif // SOFTMAX_CROSS_ENTROPY_LOSS_H
@@ -0,0 +1,375 @@
+#ifndef STATICSEQUENTIAL_H
+#define STATICSEQUENTIAL_H
+
+#include "Module.h"
+#include "SequentialNN.h"
+#include "LinearLayer.h"
+#include "ActivationLayer.h"
+#include <array>
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <random>
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @namespace StaticLayers
+ * @brief Stages for StaticSequential. Sizes are template arguments, so every loop has a
+ * compile-time trip count and the whole network inlines into one function.
+ *
+ * Each stage provides parameter_count, output_size<N>(), initialize, forward<N>, backward<N>
+ * and matches (whether a dynamic module has the same shape). Parameters use the same flat
+ * layout as the dynamic modules: LinearLayer weights row-major [out][in] followed by biases.
+ */
+namespace StaticLayers {
+
+    /**
+     * @brief Fully connected stage with In inputs and Out outputs.
+     */
+    template <size_t In, size_t Out>
+    struct Linear {
+        static constexpr size_t input_size = In;
+        static constexpr size_t parameter_count = (In + 1) * Out;
+
+        template <size_t N>
+        static constexpr size_t output_size() {
+            static_assert(N == In, "Linear input size does not match the previous stage.");
+            return Out;
+        }
+
+        static void initialize(long double* params) {
+            std::random_device rd;
+            std::default_random_engine generator(rd());
+            std::normal_distribution<long double> he_dist(0.0L, std::sqrt(2.0L / In));
+
+            for (size_t i = 0; i < In * Out; ++i) {
+                params[i] = he_dist(generator);
+            }
+            for (size_t i = 0; i < Out; ++i) {
+                params[In * Out + i] = 0.0L;
+            }
+        }
+
+        template <size_t N>
+        static void forward(const long double* params, const long double* in, long double* out) {
+            const long double* biases = params + In * Out;
+            for (size_t i = 0; i < Out; ++i) {
+                const long double* row = params + i * In;
+                long double sum = biases[i];
+                for (size_t j = 0; j < In; ++j) {
+                    sum += row[j] * in[j];
+                }
+                out[i] = sum;
+            }
+        }
+
+        template <size_t N>
+        static void backward(const long double* params, long double* grads, const long double* in,
+                             const long double* grad_out, long double* grad_in) {
+            for (size_t j = 0; j < In; ++j) {
+                grad_in[j] = 0.0L;
+            }
+            for (size_t i = 0; i < Out; ++i) {
+                const long double* row = params + i * In;
+                long double* gradient_row = grads + i * In;
+                for (size_t j = 0; j < In; ++j) {
+                    grad_in[j] += grad_out[i] * row[j];
+                    gradient_row[j] += grad_out[i] * in[j];
+                }
+                grads[In * Out + i] += grad_out[i];
+            }
+        }
+
+        static bool matches(const Module& module) {
+            const auto* layer = dynamic_cast<const LinearLayer*>(&module);
+            return layer && layer->get_input_size() == In && layer->get_output_size() == Out;
+        }
+    };
+
+    /**
+     * @brief Parameter-free element-wise stage; Op supplies value and derivative.
+     */
+    template <typename Op>
+    struct Elementwise {
+        static constexpr size_t parameter_count = 0;
+
+        template <size_t N>
+        static constexpr size_t output_size() {
+            return N;
+        }
+
+        static void initialize(long double*) {}
+
+        template <size_t N>
+        static void forward(const long double*, const long double* in, long double* out) {
+            for (size_t i = 0; i < N; ++i) {
+                out[i] = Op::value(in[i]);
+            }
+        }
+
+        template <size_t N>
+        static void backward(const long double*, long double*, const long double* in,
+                             const long double* grad_out, long double* grad_in) {
+            for (size_t i = 0; i < N; ++i) {
+                grad_in[i] = grad_out[i] * Op::derivative(in[i]);
+            }
+        }
+
+        static bool matches(const Module& module) {
+            const auto* layer = dynamic_cast<const ActivationLayer*>(&module);
+            return layer && layer->kind() == Op::kind;
+        }
+    };
+
+    struct TanhOp {
+        static constexpr ActivationKind kind = ActivationKind::Tanh;
+        static long double value(long double x) { return std::tanh(x); }
+        static long double derivative(long double x) {
+            long double t = std::tanh(x);
+            return 1.0L - t * t;
+        }
+    };
+
+    struct ReLUOp {
+        static constexpr ActivationKind kind = ActivationKind::ReLU;
+        static long double value(long double x) { return x > 0.0L ? x : 0.0L; }
+        static long double derivative(long double x) { return x > 0.0L ? 1.0L : 0.0L; }
+    };
+
+    struct SigmoidOp {
+        static constexpr ActivationKind kind = ActivationKind::Sigmoid;
+        static long double value(long double x) { return 1.0L / (1.0L + std::exp(-x)); }
+        static long double derivative(long double x) {
+            long double s = value(x);
+            return s * (1.0L - s);
+        }
+    };
+
+    using Tanh = Elementwise<TanhOp>;
+    using ReLU = Elementwise<ReLUOp>;
+    using Sigmoid = Elementwise<SigmoidOp>;
+
+    /**
+     * @brief Recursive chain of stages taking N inputs; each level caches its stage input.
+     */
+    template <size_t N, typename... Stages>
+    struct Chain;
+
+    template <size_t N>
+    struct Chain<N> {
+        static constexpr size_t output_size = N;
+        static constexpr size_t parameter_count = 0;
+
+        static void initialize(long double*) {}
+
+        void forward(const long double*, const long double* in, long double* out) {
+            std::copy_n(in, N, out);
+        }
+
+        static void predict(const long double*, const long double* in, long double* out) {
+            std::copy_n(in, N, out);
+        }
+
+        void backward(const long double*, long double*, const long double* grad_out, long double* grad_in) {
+            std::copy_n(grad_out, N, grad_in);
+        }
+
+        static bool matches(const std::vector<std::shared_ptr<Module>>& modules, size_t index) {
+            return index == modules.size();
+        }
+    };
+
+    template <size_t N, typename Stage, typename... Rest>
+    struct Chain<N, Stage, Rest...> {
+        static constexpr size_t stage_output = Stage::template output_size<N>();
+        using Next = Chain<stage_output, Rest...>;
+        static constexpr size_t output_size = Next::output_size;
+        static constexpr size_t parameter_count = Stage::parameter_count + Next::parameter_count;
+
+        std::array<long double, N> input_cache{};
+        Next next;
+
+        static void initialize(long double* params) {
+            Stage::initialize(params);
+            Next::initialize(params + Stage::parameter_count);
+        }
+
+        void forward(const long double* params, const long double* in, long double* out) {
+            std::copy_n(in, N, input_cache.begin());
+            std::array<long double, stage_output> hidden;
+            Stage::template forward<N>(params, in, hidden.data());
+            next.forward(params + Stage::parameter_count, hidden.data(), out);
+        }
+
+        static void predict(const long double* params, const long double* in, long double* out) {
+            std::array<long double, stage_output> hidden;
+            Stage::template forward<N>(params, in, hidden.data());
+            Next::predict(params + Stage::parameter_count, hidden.data(), out);
+        }
+
+        void backward(const long double* params, long double* grads, const long double* grad_out, long double* grad_in) {
+            std::array<long double, stage_output> hidden_grad;
+            next.backward(params + Stage::parameter_count, grads + Stage::parameter_count, grad_out, hidden_grad.data());
+            Stage::template backward<N>(params, grads, input_cache.data(), hidden_grad.data(), grad_in);
+        }
+
+        static bool matches(const std::vector<std::shared_ptr<Module>>& modules, size_t index) {
+            return index < modules.size() && Stage::matches(*modules[index]) && Next::matches(modules, index + 1);
+        }
+    };
+}
+
+/**
+ * @class StaticSequential
+ * @brief Fixed-topology network whose layer sizes are compile-time constants.
+ *
+ * Example: StaticSequential<Linear<30, 64>, Tanh, Linear<64, 1>> with the stages from
+ * StaticLayers. Intermediate buffers are inline arrays and the forward/backward passes are
+ * resolved at compile time, with no virtual calls or heap allocations between stages.
+ * infer() is the allocation-free entry point; the Module overrides let the model be wrapped
+ * in a Sequential and trained with LearningFacade like any other module.
+ */
+template <typename First, typename... Rest>
+class StaticSequential : public Module {
+public:
+    static constexpr size_t input_size = First::input_size;
+    using Chain = StaticLayers::Chain<input_size, First, Rest...>;
+    static constexpr size_t output_size = Chain::output_size;
+    using Input = std::array<long double, input_size>;
+    using Output = std::array<long double, output_size>;
+
+private:
+    Chain chain;
+    long double* values = nullptr;
+    long double* grads = nullptr;
+
+public:
+    /**
+     * @brief Constructor for StaticSequential; weights get He initialization, biases zero.
+     */
+    StaticSequential() {
+        StaticSequential::bind_parameters(std::make_shared<ParameterStore>(Chain::parameter_count), 0);
+        Chain::initialize(values);
+    }
+
+    /**
+     * @brief Allocation-free inference.
+     * @param inputs The input array.
+     * @return The output array.
+     */
+    Output infer(const Input& inputs) const {
+        Output outputs;
+        Chain::predict(values, inputs.data(), outputs.data());
+        return outputs;
+    }
+
+    /**
+     * @brief Allocation-free training forward pass; caches what backward_static needs.
+     * @param inputs The input array.
+     * @return The output array.
+     */
+    Output forward_static(const Input& inputs) {
+        Output outputs;
+        chain.forward(values, inputs.data(), outputs.data());
+        return outputs;
+    }
+
+    /**
+     * @brief Allocation-free backward pass; accumulates parameter gradients.
+     * @param gradients The gradient of the loss with respect to the output.
+     * @return The gradient of the loss with respect to the input.
+     */
+    Input backward_static(const Output& gradients) {
+        Input input_gradients;
+        chain.backward(values, grads, gradients.data(), input_gradients.data());
+        return input_gradients;
+    }
+
+    /**
+     * @brief Performs the forward pass.
+     * @param inputs The input tensor.
+     * @return The output tensor.
+     * @throws std::invalid_argument if the input size does not match.
+     */
+    std::vector<long double> forward(const std::vector<long double>& inputs) override {
+        if (inputs.size() != input_size) {
+            throw std::invalid_argument("Input size does not match the network's input size.");
+        }
+        std::vector<long double> outputs(output_size);
+        chain.forward(values, inputs.data(), outputs.data());
+        return outputs;
+    }
+
+    /**
+     * @brief Performs the forward pass without caching inputs.
+     * @param inputs The input tensor.
+     * @return The output tensor.
+     * @throws std::invalid_argument if the input size does not match.
+     */
+    std::vector<long double> predict(const std::vector<long double>& inputs) const override {
+        if (inputs.size() != input_size) {
+            throw std::invalid_argument("Input size does not match the network's input size.");
+        }
+        std::vector<long double> outputs(output_size);
+        Chain::predict(values, inputs.data(), outputs.data());
+        return outputs;
+    }
+
+    /**
+     * @brief Performs the backward pass.
+     * @param gradients The gradient of the loss with respect to the output.
+     * @return The gradient of the loss with respect to the input.
+     * @throws std::invalid_argument if the gradient size does not match.
+     */
+    std::vector<long double> backward(const std::vector<long double>& gradients) override {
+        if (gradients.size() != output_size) {
+            throw std::invalid_argument("Gradient size does not match the network's output size.");
+        }
+        std::vector<long double> input_gradients(input_size);
+        chain.backward(values, grads, gradients.data(), input_gradients.data());
+        return input_gradients;
+    }
+
+    /**
+     * @brief Returns the number of weights and biases of all stages.
+     */
+    size_t parameter_count() const override {
+        return Chain::parameter_count;
+    }
+
+    /**
+     * @brief Moves the parameters into a store and points the stages at it.
+     * @param store The store to register into.
+     * @param offset Position of the first parameter inside the store.
+     */
+    void bind_parameters(const std::shared_ptr<ParameterStore>& store, size_t offset) override {
+        Module::bind_parameters(store, offset);
+        values = parameters().data;
+        grads = gradients().data;
+    }
+
+    /**
+     * @brief Creates an independent copy with its own parameter store.
+     * @return The copy.
+     */
+    std::shared_ptr<Module> clone() const override {
+        auto copy = std::make_shared<StaticSequential>(*this);
+        copy->bind_parameters(std::make_shared<ParameterStore>(Chain::parameter_count), 0);
+        return copy;
+    }
+
+    /**
+     * @brief Imports the weights of a dynamic Sequential with the same topology.
+     * @param source A Sequential of LinearLayers and built-in ActivationLayers matching the stages.
+     * @throws std::invalid_argument if the topologies differ.
+     */
+    void import_parameters(const Sequential& source) {
+        if (!Chain::matches(source.get_modules(), 0)) {
+            throw std::invalid_argument("Sequential does not match the static topology.");
+        }
+        Module::copy_parameters_from(source);
+    }
+};
+
+#endif // STATICSEQUENTIAL_H
@@ -0,0 +1,96 @@
+#include "BackgroundValidator.h"
+#include "SequentialNN.h"
+#include "Embedding.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    bool has_mapped_table(const Module& module) {
+        if (const auto* embedding = dynamic_cast<const Embedding*>(&module)) {
+            return embedding->is_memory_mapped();
+        }
+        if (const auto* sequential = dynamic_cast<const Sequential*>(&module)) {
+            const auto& modules = sequential->get_modules();
+            return std::any_of(modules.begin(), modules.end(),
+                               [](const auto& child) { return has_mapped_table(*child); });
+        }
+        return false;
+    }
+
+    std::shared_ptr<Module> clone_for_snapshots(const Module& model) {
+        if (has_mapped_table(model)) {
+            throw std::invalid_argument("Background validation would copy memory-mapped embedding tables into memory.");
+        }
+        return model.clone();
+    }
+}
+
+BackgroundValidator::BackgroundValidator(const Module& model, std::shared_ptr<LossFunction> loss_function,
+                                         Iterator& validation_loader, Iterator& target_loader,
+                                         size_t patience, size_t num_threads)
+    : snapshot(clone_for_snapshots(model)), evaluator(std::move(loss_function), num_threads),
+      validation_loader(validation_loader), target_loader(target_loader), patience(patience) {}
+
+BackgroundValidator::~BackgroundValidator() {
+    if (pending.valid()) {
+        pending.wait();
+    }
+}
+
+void BackgroundValidator::collect() {
+    if (!pending.valid()) {
+        return;
+    }
+
+    EvaluationResults results = pending.get();
+    history.push_back(results);
+
+    if (results.loss < best_loss) {
+        best_loss = results.loss;
+        best_epoch = pending_epoch;
+        if (best_snapshot) {
+            best_snapshot->copy_parameters_from(*snapshot);
+        } else {
+            best_snapshot = snapshot->clone();
+        }
+        epochs_without_improvement = 0;
+    } else {
+        ++epochs_without_improvement;
+    }
+}
+
+void BackgroundValidator::submit(const Module& model, size_t epoch) {
+    collect();
+
+    snapshot->copy_parameters_from(model);
+
+    pending_epoch = epoch;
+    pending = std::async(std::launch::async, [this]() {
+        return evaluator.evaluate(*snapshot, validation_loader, target_loader);
+    });
+}
+
+void BackgroundValidator::finish() {
+    collect();
+}
+
+bool BackgroundValidator::should_stop() const {
+    return patience > 0 && epochs_without_improvement >= patience;
+}
+
+bool BackgroundValidator::restore_best(Module& model) const {
+    if (!best_snapshot) {
+        return false;
+    }
+
+    model.copy_parameters_from(*best_snapshot);
+    return true;
+}
+
+size_t BackgroundValidator::get_best_epoch() const {
+    return best_epoch;
+}
+
+const std::vector<EvaluationResults>& BackgroundValidator::get_history() const {
+    return history;
+}
@@ -0,0 +1,101 @@
+#ifndef BACKGROUNDVALIDATOR_H
+#define BACKGROUNDVALIDATOR_H
+
+#include "Module.h"
+#include "LossFunction.h"
+#include "Iterator.h"
+#include "Evaluator.h"
+#include <future>
+#include <memory>
+#include <vector>
+#include <limits>
+
+/**
+ * @class BackgroundValidator
+ * @brief Validates weight snapshots on a separate thread while training continues.
+ *
+ * Each submitted epoch copies the model's parameters into a private clone and evaluates
+ * that clone asynchronously. Results are collected when the next epoch is submitted, so the
+ * early stopping decision for epoch N is available after epoch N + 1 has been trained.
+ * The parameters of the epoch with the lowest validation loss are retained.
+ */
+class BackgroundValidator {
+private:
+    std::shared_ptr<Module> snapshot;
+    Evaluator evaluator;
+    Iterator& validation_loader;
+    Iterator& target_loader;
+    size_t patience;
+
+    std::future<EvaluationResults> pending;
+    size_t pending_epoch = 0;
+
+    std::vector<EvaluationResults> history;
+    std::shared_ptr<Module> best_snapshot;
+    long double best_loss = std::numeric_limits<long double>::infinity();
+    size_t best_epoch = 0;
+    size_t epochs_without_improvement = 0;
+
+    /**
+     * @brief Waits for the in-flight validation, if any, and records its results.
+     */
+    void collect();
+
+public:
+    /**
+     * @brief Constructor for BackgroundValidator.
+     * @param model The model being trained; it is cloned once to hold the snapshots.
+     * @param loss_function The loss function used for validation.
+     * @param validation_loader Validation data loader.
+     * @param target_loader Validation target loader.
+     * @param patience Epochs without improvement before stopping (0 never stops).
+     * @param num_threads Threads used by each validation run.
+     * @throws std::invalid_argument if the model has a memory-mapped Embedding table, which
+     * every snapshot would copy into memory.
+     */
+    BackgroundValidator(const Module& model, std::shared_ptr<LossFunction> loss_function,
+                        Iterator& validation_loader, Iterator& target_loader,
+                        size_t patience = 0, size_t num_threads = 1);
+
+    /**
+     * @brief Waits for any validation still running.
+     */
+    ~BackgroundValidator();
+
+    /**
+     * @brief Snapshots the model's parameters and starts validating them in the background.
+     * Blocks only if the previous epoch is still being validated.
+     * @param model The model being trained, with the same topology as at construction.
+     * @param epoch The epoch that just finished.
+     */
+    void submit(const Module& model, size_t epoch);
+
+    /**
+     * @brief Waits for the last submitted validation.
+     */
+    void finish();
+
+    /**
+     * @brief Checks whether validation loss stopped improving for more than patience epochs.
+     */
+    bool should_stop() const;
+
+    /**
+     * @brief Copies the best snapshot into the model.
+     * @param model The model being trained.
+     * @return False if no epoch has been validated yet.
+     */
+    bool restore_best(Module& model) const;
+
+    /**
+     * @brief Returns the epoch with the lowest validation loss (0 if none).
+     */
+    size_t get_best_epoch() const;
+
+    /**
+     * @brief Returns the validation results of every collected epoch, in order.
+     */
+    const std::vector<EvaluationResults>& get_history() const;
+};
+
+#endif // BACKGROUNDVALIDATOR_H
@@ -0,0 +1,94 @@
+#include "Communicator.h"
+#include <algorithm>
+#include <stdexcept>
+
+Communicator::Communicator(size_t rank, size_t world_size)
+    : rank(rank), world_size(world_size) {
+    if (world_size == 0 || rank >= world_size) {
+        throw std::invalid_argument("Rank must be smaller than the world size.");
+    }
+}
+
+size_t Communicator::get_rank() const {
+    return rank;
+}
+
+size_t Communicator::get_world_size() const {
+    return world_size;
+}
+
+void Communicator::all_reduce_sum(long double* data, size_t count) {
+    if (world_size == 1 || count == 0) {
+        return;
+    }
+
+    // Chunk c covers [bounds[c], bounds[c + 1]).
+    std::vector<size_t> bounds(world_size + 1);
+    for (size_t c = 0; c <= world_size; ++c) {
+        bounds[c] = count * c / world_size;
+    }
+    auto chunk_size = [&](size_t c) { return bounds[c + 1] - bounds[c]; };
+    receive_buffer.resize(count / world_size + 1);
+
+    // Reduce-scatter: after n - 1 steps rank r holds the full sum of chunk (r + 1) % n.
+    for (size_t step = 0; step + 1 < world_size; ++step) {
+        size_t send_chunk = (rank + world_size - step) % world_size;
+        size_t receive_chunk = (rank + world_size - step - 1) % world_size;
+        ring_exchange(data + bounds[send_chunk], chunk_size(send_chunk) * sizeof(long double),
+                      receive_buffer.data(), chunk_size(receive_chunk) * sizeof(long double));
+        long double* target = data + bounds[receive_chunk];
+        for (size_t i = 0; i < chunk_size(receive_chunk); ++i) {
+            target[i] += receive_buffer[i];
+        }
+    }
+
+    // All-gather: pass the reduced chunks around the ring.
+    for (size_t step = 0; step + 1 < world_size; ++step) {
+        size_t send_chunk = (rank + 1 + world_size - step) % world_size;
+        size_t receive_chunk = (rank + world_size - step) % world_size;
+        ring_exchange(data + bounds[send_chunk], chunk_size(send_chunk) * sizeof(long double),
+                      data + bounds[receive_chunk], chunk_size(receive_chunk) * sizeof(long double));
+    }
+}
+
+void Communicator::all_reduce_mean(long double* data, size_t count) {
+    all_reduce_sum(data, count);
+    if (world_size > 1) {
+        long double scale = 1.0L / world_size;
+        for (size_t i = 0; i < count; ++i) {
+            data[i] *= scale;
+        }
+    }
+}
+
+void Communicator::broadcast(long double* data, size_t count, size_t root) {
+    if (root >= world_size) {
+        throw std::invalid_argument("Broadcast root must be smaller than the world size.");
+    }
+    if (world_size == 1 || count == 0) {
+        return;
+    }
+
+    // Segments let a rank forward segment k while it receives segment k + 1.
+    constexpr size_t segment = 4096;
+    size_t segments = (count + segment - 1) / segment;
+    auto segment_data = [&](size_t k) { return data + k * segment; };
+    auto segment_bytes = [&](size_t k) { return std::min(segment, count - k * segment) * sizeof(long double); };
+
+    bool receives = rank != root;
+    bool forwards = (rank + 1) % world_size != root;
+    if (receives) {
+        ring_exchange(nullptr, 0, segment_data(0), segment_bytes(0));
+    }
+    for (size_t k = 0; k < segments; ++k) {
+        bool more = receives && k + 1 < segments;
+        ring_exchange(forwards ? segment_data(k) : nullptr, forwards ? segment_bytes(k) : 0,
+                      more ? segment_data(k + 1) : nullptr, more ? segment_bytes(k + 1) : 0);
+    }
+}
+
+void Communicator::barrier() {
+    // One value per rank, so every step of the ring moves data.
+    std::vector<long double> tokens(world_size, 0.0L);
+    all_reduce_sum(tokens.data(), tokens.size());
+}
@@ -0,0 +1,92 @@
+#ifndef COMMUNICATOR_H
+#define COMMUNICATOR_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class Communicator
+ * @brief Collective operations between the ranks of a data-parallel job.
+ *
+ * The ranks form a ring: each one only talks to its successor (rank + 1) and predecessor
+ * (rank - 1). Transports implement a single primitive, ring_exchange, and the collectives
+ * are built on top of it: all_reduce uses the bandwidth-optimal ring algorithm (a
+ * reduce-scatter followed by an all-gather, each rank sending 2 (n - 1) / n of the data)
+ * and broadcast pipelines the data around the ring.
+ *
+ * Every rank must call the same collectives in the same order with the same sizes. A
+ * communicator is not thread safe; use it from one thread at a time.
+ */
+class Communicator {
+private:
+    std::vector<long double> receive_buffer;
+
+protected:
+    size_t rank;
+    size_t world_size;
+
+    /**
+     * @brief Constructor for Communicator.
+     * @param rank This process's rank, in [0, world_size).
+     * @param world_size Number of ranks.
+     * @throws std::invalid_argument if rank is out of range.
+     */
+    Communicator(size_t rank, size_t world_size);
+
+public:
+    virtual ~Communicator() = default;
+
+    Communicator(const Communicator&) = delete;
+    Communicator& operator=(const Communicator&) = delete;
+
+    /**
+     * @brief Sends bytes to the successor while receiving bytes from the predecessor.
+     * Both transfers progress concurrently, so neighbours exchanging at the same time
+     * cannot deadlock. Either size may be zero.
+     * @param send_data Data for rank + 1.
+     * @param send_bytes Size of send_data.
+     * @param receive_data Buffer for the data from rank - 1.
+     * @param receive_bytes Size expected from rank - 1.
+     * @throws std::runtime_error if the transport fails.
+     */
+    virtual void ring_exchange(const void* send_data, size_t send_bytes, void* receive_data, size_t receive_bytes) = 0;
+
+    /**
+     * @brief Returns this process's rank.
+     */
+    size_t get_rank() const;
+
+    /**
+     * @brief Returns the number of ranks.
+     */
+    size_t get_world_size() const;
+
+    /**
+     * @brief Replaces data on every rank with the element-wise sum over all ranks.
+     * @param data The local values.
+     * @param count Number of values; must match on every rank.
+     */
+    void all_reduce_sum(long double* data, size_t count);
+
+    /**
+     * @brief Replaces data on every rank with the element-wise mean over all ranks.
+     * @param data The local values.
+     * @param count Number of values; must match on every rank.
+     */
+    void all_reduce_mean(long double* data, size_t count);
+
+    /**
+     * @brief Copies data from the root rank to every other rank.
+     * @param data The values to send (on root) or the buffer to fill (elsewhere).
+     * @param count Number of values; must match on every rank.
+     * @param root The rank whose values are broadcast.
+     */
+    void broadcast(long double* data, size_t count, size_t root = 0);
+
+    /**
+     * @brief Blocks until every rank has reached the barrier.
+     */
+    void barrier();
+};
+
+#endif // COMMUNICATOR_H
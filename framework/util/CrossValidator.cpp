@@ -0,0 +1,165 @@
+#include "CrossValidator.h"
+#include "ThreadPool.h"
+#include "LearningFacade.h"
+#include "DataFrameView.h"
+#include "SGD.h"
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief Population standard deviation of a fold metric.
+     */
+    template <typename Metric>
+    long double stddev(const std::vector<FoldResult>& folds, long double mean, Metric metric) {
+        long double sum = 0.0L;
+        for (const auto& fold : folds) {
+            long double delta = metric(fold) - mean;
+            sum += delta * delta;
+        }
+        return std::sqrt(sum / folds.size());
+    }
+}
+
+CrossValidator::CrossValidator(const DataFrame& data, const DataFrame& target,
+                               std::shared_ptr<LossFunction> loss_function,
+                               std::vector<std::vector<size_t>> folds, size_t num_threads)
+    : data(data), target(target), loss_function(std::move(loss_function)), folds(std::move(folds)),
+      num_threads(num_threads) {
+    if (data.row_count() != target.row_count()) {
+        throw std::invalid_argument("Data and target must have the same number of rows.");
+    }
+    if (this->folds.size() < 2) {
+        throw std::invalid_argument("Cross-validation needs at least two folds.");
+    }
+    std::vector<bool> assigned(data.row_count(), false);
+    for (const auto& fold : this->folds) {
+        for (size_t row : fold) {
+            if (row >= data.row_count()) {
+                throw std::invalid_argument("A fold refers to a row that does not exist.");
+            }
+            if (assigned[row]) {
+                throw std::invalid_argument("Folds overlap: a row would be used for both training and validation.");
+            }
+            assigned[row] = true;
+        }
+    }
+}
+
+CrossValidationResults CrossValidator::run(const ModelFactory& make_model, long double learning_rate,
+                                           size_t epochs, size_t accumulation_steps) const {
+    return run(make_model, [learning_rate] { return std::make_unique<SGD>(learning_rate); },
+               epochs, accumulation_steps);
+}
+
+CrossValidationResults CrossValidator::run(const ModelFactory& make_model, const OptimizerFactory& make_optimizer,
+                                           size_t epochs, size_t accumulation_steps) const {
+    size_t k = folds.size();
+    CrossValidationResults results;
+    results.folds.resize(k);
+    std::vector<std::unique_ptr<Optimizer>> optimizers(k);
+    for (size_t f = 0; f < k; ++f) {
+        results.folds[f].fold = f;
+        // Copies of a Sequential share their modules, so every fold trains its own clone.
+        results.folds[f].model = *std::dynamic_pointer_cast<Sequential>(make_model().clone());
+        optimizers[f] = make_optimizer();
+    }
+
+    auto run_fold = [&](size_t f) {
+        FoldResult& result = results.folds[f];
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<size_t> train_rows;
+        for (size_t other = 0; other < k; ++other) {
+            if (other != f) {
+                train_rows.insert(train_rows.end(), folds[other].begin(), folds[other].end());
+            }
+        }
+        DataFrameView train_data(data, train_rows);
+        DataFrameView train_target(target, std::move(train_rows));
+        DataFrameView validation_data(data, folds[f]);
+        DataFrameView validation_target(target, folds[f]);
+
+        LearningFacade facade(result.model, loss_function, epochs);
+        facade.set_terminal_display(false);
+        auto train_loader = train_data.create_iterator();
+        auto target_loader = train_target.create_iterator();
+        facade.train(*train_loader, *target_loader, *optimizers[f], accumulation_steps);
+
+        auto validation_loader = validation_data.create_iterator();
+        auto validation_target_loader = validation_target.create_iterator();
+        result.metrics = Evaluator(loss_function, 1).evaluate(result.model, *validation_loader, *validation_target_loader);
+        result.train_rows = train_data.row_count();
+        result.validation_rows = validation_data.row_count();
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    {
+        ThreadPool pool(num_threads);
+        std::vector<std::future<void>> pending;
+        for (size_t f = 0; f < k; ++f) {
+            pending.push_back(pool.submit([&run_fold, f] { run_fold(f); }));
+        }
+        for (auto& future : pending) {
+            future.get();
+        }
+    }
+
+    size_t roc_auc_folds = 0;
+    for (const auto& fold : results.folds) {
+        results.mean_loss += fold.metrics.loss / k;
+        results.mean_accuracy += fold.metrics.accuracy / k;
+        if (!std::isnan(fold.metrics.roc_auc)) {
+            results.mean_roc_auc += fold.metrics.roc_auc;
+            ++roc_auc_folds;
+        }
+
+        const auto& confusion = fold.metrics.confusion_matrix;
+        if (results.confusion_matrix.size() < confusion.size()) {
+            results.confusion_matrix.resize(confusion.size());
+        }
+        for (size_t actual = 0; actual < confusion.size(); ++actual) {
+            auto& row = results.confusion_matrix[actual];
+            if (row.size() < confusion[actual].size()) {
+                row.resize(confusion[actual].size(), 0);
+            }
+            for (size_t predicted = 0; predicted < confusion[actual].size(); ++predicted) {
+                row[predicted] += confusion[actual][predicted];
+            }
+        }
+    }
+    results.mean_roc_auc = roc_auc_folds ? results.mean_roc_auc / roc_auc_folds
+                                         : std::numeric_limits<long double>::quiet_NaN();
+    results.loss_stddev = stddev(results.folds, results.mean_loss, [](const FoldResult& fold) { return fold.metrics.loss; });
+    results.accuracy_stddev = stddev(results.folds, results.mean_accuracy, [](const FoldResult& fold) { return fold.metrics.accuracy; });
+    return results;
+}
+
+void CrossValidator::print_results(const CrossValidationResults& results, std::ostream& out) {
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    out << std::left << std::setw(6) << "Fold" << std::setw(12) << "Train rows" << std::setw(12) << "Val rows"
+        << std::setw(14) << "Val loss" << std::setw(12) << "Val acc %" << std::setw(10) << "ROC-AUC" << "Seconds\n";
+    out << std::fixed;
+    for (const auto& fold : results.folds) {
+        out << std::left << std::setw(6) << fold.fold + 1 << std::setw(12) << fold.train_rows
+            << std::setw(12) << fold.validation_rows
+            << std::setw(14) << std::setprecision(6) << static_cast<double>(fold.metrics.loss)
+            << std::setw(12) << std::setprecision(2) << static_cast<double>(fold.metrics.accuracy)
+            << std::setw(10) << std::setprecision(4) << static_cast<double>(fold.metrics.roc_auc)
+            << std::setprecision(2) << fold.seconds << "\n";
+    }
+    out << "Loss: " << std::setprecision(6) << static_cast<double>(results.mean_loss)
+        << " +/- " << static_cast<double>(results.loss_stddev) << "\n";
+    out << "Accuracy: " << std::setprecision(2) << static_cast<double>(results.mean_accuracy)
+        << "% +/- " << static_cast<double>(results.accuracy_stddev) << "\n";
+    out << "ROC-AUC: " << std::setprecision(4) << static_cast<double>(results.mean_roc_auc) << "\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
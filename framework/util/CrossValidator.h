@@ -0,0 +1,109 @@
+#ifndef CROSSVALIDATOR_H
+#define CROSSVALIDATOR_H
+
+#include "DataFrame.h"
+#include "SequentialNN.h"
+#include "LossFunction.h"
+#include "Optimizer.h"
+#include "Evaluator.h"
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/**
+ * @struct FoldResult
+ * @brief Outcome of one fold of a cross-validation.
+ */
+struct FoldResult {
+    size_t fold = 0;
+    size_t train_rows = 0;
+    size_t validation_rows = 0;
+    EvaluationResults metrics;   ///< Measured on the fold's held-out rows.
+    double seconds = 0.0;        ///< Training and evaluation time.
+    Sequential model;            ///< The model trained without this fold.
+};
+
+/**
+ * @struct CrossValidationResults
+ * @brief Per-fold results and their aggregate, as returned by CrossValidator::run.
+ */
+struct CrossValidationResults {
+    std::vector<FoldResult> folds;
+    long double mean_loss = 0.0L;
+    long double loss_stddev = 0.0L;
+    long double mean_accuracy = 0.0L;      ///< In percent.
+    long double accuracy_stddev = 0.0L;
+    long double mean_roc_auc = 0.0L;       ///< Over the folds where it is defined; NaN if none.
+    std::vector<std::vector<size_t>> confusion_matrix;   ///< Summed over the folds.
+};
+
+/**
+ * @class CrossValidator
+ * @brief k-fold cross-validation with the folds trained in parallel.
+ *
+ * Every fold trains a fresh model on all rows outside the fold and evaluates it on the
+ * fold. Training and validation sets are DataFrameViews over the one DataFrame, so no row
+ * is copied however many folds run. Folds are trained on a thread pool, one fold per
+ * thread, so k folds cost about one training run on a host with k free cores.
+ */
+class CrossValidator {
+private:
+    const DataFrame& data;
+    const DataFrame& target;
+    std::shared_ptr<LossFunction> loss_function;
+    std::vector<std::vector<size_t>> folds;
+    size_t num_threads;
+
+public:
+    using ModelFactory = std::function<Sequential()>;
+    using OptimizerFactory = std::function<std::unique_ptr<Optimizer>()>;
+
+    /**
+     * @brief Constructor for CrossValidator.
+     * The DataFrames are referenced, not copied, and must outlive the validator.
+     * @param data Input data.
+     * @param target Target data.
+     * @param loss_function The loss function used for training and evaluation.
+     * @param folds Row indices of every fold, e.g. from DataFrameUtils::k_fold or stratified_k_fold.
+     * @param num_threads Number of folds trained at once (0 uses every hardware thread).
+     * @throws std::invalid_argument if there are fewer than two folds, the row counts of data
+     * and target differ, a fold refers to a missing row, or a row is in more than one fold.
+     */
+    CrossValidator(const DataFrame& data, const DataFrame& target, std::shared_ptr<LossFunction> loss_function,
+                   std::vector<std::vector<size_t>> folds, size_t num_threads = 0);
+
+    /**
+     * @brief Trains and evaluates every fold.
+     * The factories run on the calling thread, once per fold, before training starts.
+     * Every fold trains a clone of the model returned by make_model, so the factory may
+     * return the same model each time.
+     * @param make_model Returns the untrained model of a fold.
+     * @param make_optimizer Returns a new optimizer for one fold.
+     * @param epochs Training epochs per fold.
+     * @param accumulation_steps Number of samples whose gradients are averaged per update.
+     * @return Per-fold metrics and models, and their aggregate.
+     */
+    CrossValidationResults run(const ModelFactory& make_model, const OptimizerFactory& make_optimizer,
+                               size_t epochs, size_t accumulation_steps = 1) const;
+
+    /**
+     * @brief Trains and evaluates every fold with plain gradient descent.
+     * @param make_model Returns a new, untrained model.
+     * @param learning_rate Learning rate for training.
+     * @param epochs Training epochs per fold.
+     * @param accumulation_steps Number of samples whose gradients are averaged per update.
+     * @return Per-fold metrics and models, and their aggregate.
+     */
+    CrossValidationResults run(const ModelFactory& make_model, long double learning_rate,
+                               size_t epochs, size_t accumulation_steps = 1) const;
+
+    /**
+     * @brief Prints the per-fold metrics and their mean and standard deviation.
+     * @param results Results returned by run.
+     * @param out Output stream.
+     */
+    static void print_results(const CrossValidationResults& results, std::ostream& out = std::cout);
+};
+
+#endif // CROSSVALIDATOR_H
@@ -0,0 +1,215 @@
+#include "Evaluator.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace {
+    struct Accumulator {
+        long double loss = 0.0L;
+        size_t correct = 0;
+        size_t samples = 0;
+        std::vector<size_t> confusion;                      // classes x classes, row-major
+        std::vector<std::pair<long double, bool>> scores;   // exact ROC-AUC
+        std::vector<size_t> positive_histogram;             // approximate ROC-AUC
+        std::vector<size_t> negative_histogram;
+
+        void merge(const Accumulator& other) {
+            loss += other.loss;
+            correct += other.correct;
+            samples += other.samples;
+            for (size_t i = 0; i < confusion.size(); ++i) {
+                confusion[i] += other.confusion[i];
+            }
+            scores.insert(scores.end(), other.scores.begin(), other.scores.end());
+            for (size_t i = 0; i < positive_histogram.size(); ++i) {
+                positive_histogram[i] += other.positive_histogram[i];
+                negative_histogram[i] += other.negative_histogram[i];
+            }
+        }
+    };
+
+    long double exact_auc(std::vector<std::pair<long double, bool>>& scores) {
+        std::sort(scores.begin(), scores.end());
+
+        // Mann-Whitney U: sum of positive ranks, tied scores share their average rank
+        long double positive_rank_sum = 0.0L;
+        size_t positives = 0;
+        for (size_t i = 0; i < scores.size();) {
+            size_t j = i;
+            size_t tied_positives = 0;
+            while (j < scores.size() && scores[j].first == scores[i].first) {
+                tied_positives += scores[j].second;
+                ++j;
+            }
+            long double average_rank = (i + 1 + j) / 2.0L;
+            positive_rank_sum += average_rank * tied_positives;
+            positives += tied_positives;
+            i = j;
+        }
+
+        size_t negatives = scores.size() - positives;
+        if (positives == 0 || negatives == 0) {
+            return std::numeric_limits<long double>::quiet_NaN();
+        }
+        return (positive_rank_sum - positives * (positives + 1) / 2.0L) / (static_cast<long double>(positives) * negatives);
+    }
+
+    long double histogram_auc(const std::vector<size_t>& positive, const std::vector<size_t>& negative) {
+        long double pairs = 0.0L;
+        size_t negatives_below = 0;
+        size_t positives = 0;
+        for (size_t b = 0; b < positive.size(); ++b) {
+            pairs += static_cast<long double>(positive[b]) * negatives_below
+                   + 0.5L * static_cast<long double>(positive[b]) * negative[b];
+            negatives_below += negative[b];
+            positives += positive[b];
+        }
+
+        if (positives == 0 || negatives_below == 0) {
+            return std::numeric_limits<long double>::quiet_NaN();
+        }
+        return pairs / (static_cast<long double>(positives) * negatives_below);
+    }
+}
+
+Evaluator::Evaluator(std::shared_ptr<LossFunction> loss_function, size_t num_threads, size_t auc_bins)
+    : loss_function(std::move(loss_function)), num_threads(num_threads), auc_bins(auc_bins) {
+    if (this->num_threads == 0) {
+        this->num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+EvaluationResults Evaluator::evaluate(const Module& model, Iterator& test_loader, Iterator& target_loader) const {
+    std::vector<const std::vector<long double>*> inputs;
+    std::vector<const std::vector<long double>*> targets;
+    inputs.reserve(test_loader.size());
+    targets.reserve(target_loader.size());
+
+    test_loader.reset();
+    target_loader.reset();
+    while (test_loader.has_more() && target_loader.has_more()) {
+        inputs.push_back(&test_loader.get_next());
+        targets.push_back(&target_loader.get_next());
+    }
+    return evaluate_rows(targets, [&model, &inputs](size_t row) { return model.predict(*inputs[row]); });
+}
+
+EvaluationResults Evaluator::evaluate(const Module& model, SparseIterator& test_loader, Iterator& target_loader) const {
+    std::vector<SparseRow> inputs;
+    std::vector<const std::vector<long double>*> targets;
+    inputs.reserve(test_loader.size());
+    targets.reserve(target_loader.size());
+
+    test_loader.reset();
+    target_loader.reset();
+    while (test_loader.has_more() && target_loader.has_more()) {
+        inputs.push_back(test_loader.get_next());
+        targets.push_back(&target_loader.get_next());
+    }
+    return evaluate_rows(targets, [&model, &inputs](size_t row) { return model.predict_sparse(inputs[row]); });
+}
+
+EvaluationResults Evaluator::evaluate_rows(const std::vector<const std::vector<long double>*>& targets,
+                                           const std::function<std::vector<long double>(size_t)>& predict) const {
+    if (targets.empty()) {
+        throw std::invalid_argument("Cannot evaluate an empty test set.");
+    }
+
+    // the class count follows from the width of the first prediction
+    size_t output_size = predict(0).size();
+    size_t classes = std::max<size_t>(output_size, 2);
+
+    auto make_accumulator = [&]() {
+        Accumulator acc;
+        acc.confusion.assign(classes * classes, 0);
+        acc.positive_histogram.assign(auc_bins, 0);
+        acc.negative_histogram.assign(auc_bins, 0);
+        return acc;
+    };
+
+    size_t threads = std::min(num_threads, targets.size());
+    std::vector<Accumulator> accumulators(threads, make_accumulator());
+
+    auto evaluate_shard = [&](size_t shard) {
+        Accumulator& acc = accumulators[shard];
+        size_t begin = shard * targets.size() / threads;
+        size_t end = (shard + 1) * targets.size() / threads;
+
+        for (size_t n = begin; n < end; ++n) {
+            auto prediction = predict(n);
+            const long double* target = targets[n]->data();
+
+            acc.loss += loss_function->compute_loss_and_gradient(prediction.data(), target, nullptr, 1, output_size);
+
+            size_t predicted = loss_function->predicted_class(prediction.data(), output_size);
+            size_t actual = static_cast<size_t>(target[0]);
+            if (predicted == actual) {
+                ++acc.correct;
+            }
+            if (actual < classes && predicted < classes) {
+                ++acc.confusion[actual * classes + predicted];
+            }
+
+            if (classes == 2) {
+                long double score = loss_function->positive_score(prediction.data(), output_size);
+                bool positive = actual == 1;
+                if (auc_bins == 0) {
+                    acc.scores.emplace_back(score, positive);
+                } else {
+                    size_t bin = std::min(static_cast<size_t>(std::max(score, 0.0L) * auc_bins), auc_bins - 1);
+                    ++(positive ? acc.positive_histogram : acc.negative_histogram)[bin];
+                }
+            }
+            ++acc.samples;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; ++t) {
+        workers.emplace_back(evaluate_shard, t);
+    }
+    evaluate_shard(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    Accumulator total = make_accumulator();
+    for (const auto& acc : accumulators) {
+        total.merge(acc);
+    }
+
+    EvaluationResults results;
+    results.samples = total.samples;
+    results.loss = total.loss / total.samples;
+    results.accuracy = static_cast<long double>(total.correct) / total.samples * 100.0L;
+    results.confusion_matrix.assign(classes, std::vector<size_t>(classes, 0));
+    results.precision.assign(classes, 0.0L);
+    results.recall.assign(classes, 0.0L);
+
+    for (size_t actual = 0; actual < classes; ++actual) {
+        for (size_t predicted = 0; predicted < classes; ++predicted) {
+            results.confusion_matrix[actual][predicted] = total.confusion[actual * classes + predicted];
+        }
+    }
+    for (size_t c = 0; c < classes; ++c) {
+        size_t predicted_as_c = 0;
+        size_t actually_c = 0;
+        for (size_t other = 0; other < classes; ++other) {
+            predicted_as_c += results.confusion_matrix[other][c];
+            actually_c += results.confusion_matrix[c][other];
+        }
+        size_t true_positives = results.confusion_matrix[c][c];
+        results.precision[c] = predicted_as_c ? static_cast<long double>(true_positives) / predicted_as_c : 0.0L;
+        results.recall[c] = actually_c ? static_cast<long double>(true_positives) / actually_c : 0.0L;
+    }
+
+    if (classes == 2) {
+        results.roc_auc = auc_bins == 0
+            ? exact_auc(total.scores)
+            : histogram_auc(total.positive_histogram, total.negative_histogram);
+    }
+
+    return results;
+}
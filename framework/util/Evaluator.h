@@ -0,0 +1,86 @@
+#ifndef EVALUATOR_H
+#define EVALUATOR_H
+
+#include "Module.h"
+#include "LossFunction.h"
+#include "Iterator.h"
+#include "SparseIterator.h"
+#include <functional>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <limits>
+
+/**
+ * @struct EvaluationResults
+ * @brief Metrics collected by Evaluator::evaluate.
+ */
+struct EvaluationResults {
+    size_t samples = 0;
+    long double loss = 0.0L;                            ///< Average loss per sample.
+    long double accuracy = 0.0L;                        ///< Accuracy in percent.
+    std::vector<std::vector<size_t>> confusion_matrix;  ///< Counts indexed by [actual][predicted].
+    std::vector<long double> precision;                 ///< Per class.
+    std::vector<long double> recall;                    ///< Per class.
+    /// Two classes only. NaN when undefined: more than two classes, or a test set holding
+    /// a single class (no positive/negative pair to rank).
+    long double roc_auc = std::numeric_limits<long double>::quiet_NaN();
+};
+
+/**
+ * @class Evaluator
+ * @brief Parallel single-pass evaluation of a model over a test set.
+ *
+ * The test rows are split into one shard per thread. Each thread runs Module::predict (or
+ * Module::predict_sparse for sparse inputs) and fills its own accumulator; accumulators are merged once all threads finish. ROC-AUC is
+ * exact by default, or approximated from score histograms when auc_bins is set, which keeps
+ * memory constant for very large test sets.
+ */
+class Evaluator {
+private:
+    std::shared_ptr<LossFunction> loss_function;
+    size_t num_threads;
+    size_t auc_bins;
+
+    /**
+     * @brief Evaluates every row in parallel and merges the metrics.
+     * @param targets The target rows.
+     * @param predict Returns the model outputs for a row index; called concurrently.
+     * @throws std::invalid_argument if there are no rows.
+     */
+    EvaluationResults evaluate_rows(const std::vector<const std::vector<long double>*>& targets,
+                                    const std::function<std::vector<long double>(size_t)>& predict) const;
+
+public:
+    /**
+     * @brief Constructor for Evaluator.
+     * @param loss_function The loss function, which also interprets the model outputs.
+     * @param num_threads Number of worker threads (0 uses every hardware thread).
+     * @param auc_bins Histogram bins for an approximate ROC-AUC (0 computes it exactly).
+     */
+    explicit Evaluator(std::shared_ptr<LossFunction> loss_function, size_t num_threads = 0, size_t auc_bins = 0);
+
+    /**
+     * @brief Evaluates a model.
+     * The rows returned by the loaders must stay valid until the call returns,
+     * which holds for DataFrame iterators.
+     * @param model The model to evaluate; it must not be modified during the call.
+     * @param test_loader Testing data loader.
+     * @param target_loader Testing target loader.
+     * @return Loss, accuracy, confusion matrix, per-class precision and recall, and ROC-AUC.
+     */
+    EvaluationResults evaluate(const Module& model, Iterator& test_loader, Iterator& target_loader) const;
+
+    /**
+     * @brief Evaluates a model on sparse inputs.
+     * The rows returned by the loaders must stay valid until the call returns,
+     * which holds for SparseDataFrame and DataFrame iterators.
+     * @param model The model to evaluate; its first module must accept sparse inputs.
+     * @param test_loader Sparse testing data loader.
+     * @param target_loader Testing target loader.
+     * @return Loss, accuracy, confusion matrix, per-class precision and recall, and ROC-AUC.
+     */
+    EvaluationResults evaluate(const Module& model, SparseIterator& test_loader, Iterator& target_loader) const;
+};
+
+#endif // EVALUATOR_H
@@ -1,19 +1,197 @@
 #include "EventManager.h"
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
 
-void EventManager::subscribe(const std::string& event_type, const std::function<void(double, size_t)>& listener) {
-    listeners[event_type].push_back(listener);
+namespace {
+    struct NameRegistry {
+        std::mutex mutex;
+        std::unordered_map<std::string, EventId> ids;
+        std::deque<std::string> names;
+    };
+
+    NameRegistry& registry() {
+        static NameRegistry instance;
+        return instance;
+    }
+}
+
+Event::Event(EventId type, double value, size_t epoch, size_t step)
+    : type(type), value(value), epoch(epoch), step(step), timestamp(std::chrono::steady_clock::now()) {}
+
+Event& Event::add_metric(EventId name, double metric_value) {
+    if (metric_count == MAX_METRICS) {
+        throw std::length_error("Event already carries the maximum number of metrics.");
+    }
+    metrics[metric_count++] = {name, metric_value};
+    return *this;
+}
+
+double Event::get_metric(EventId name, double fallback) const {
+    for (size_t i = 0; i < metric_count; ++i) {
+        if (metrics[i].name == name) {
+            return metrics[i].value;
+        }
+    }
+    return fallback;
+}
+
+EventManager::EventManager(size_t queue_capacity, std::chrono::milliseconds poll_interval)
+    : queue(queue_capacity), poll_interval(poll_interval) {
+    dispatcher = std::thread(&EventManager::run, this);
+}
+
+EventManager::~EventManager() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    dispatcher.join();
+}
+
+EventId EventManager::intern(const std::string& name) {
+    NameRegistry& names = registry();
+    std::lock_guard<std::mutex> lock(names.mutex);
+    auto it = names.ids.find(name);
+    if (it != names.ids.end()) {
+        return it->second;
+    }
+    auto id = static_cast<EventId>(names.names.size());
+    names.names.push_back(name);
+    names.ids.emplace(name, id);
+    return id;
+}
+
+const std::string& EventManager::name_of(EventId id) {
+    NameRegistry& names = registry();
+    std::lock_guard<std::mutex> lock(names.mutex);
+    return names.names.at(id);
+}
+
+SubscriptionId EventManager::subscribe(EventId type, Listener listener, std::chrono::milliseconds min_interval) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Subscription subscription;
+    subscription.id = next_subscription++;
+    subscription.listener = std::move(listener);
+    subscription.min_interval = min_interval;
+    subscriptions[type].push_back(std::move(subscription));
+    return subscriptions[type].back().id;
+}
+
+SubscriptionId EventManager::subscribe(const std::string& event_type, const std::function<void(double, size_t)>& listener) {
+    return subscribe(intern(event_type), [listener](const Event& event) {
+        listener(event.value, event.epoch);
+    });
+}
+
+void EventManager::unsubscribe(SubscriptionId id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& entry : subscriptions) {
+        auto& list = entry.second;
+        list.erase(std::remove_if(list.begin(), list.end(),
+                                  [id](const Subscription& s) { return s.id == id; }),
+                   list.end());
+    }
 }
 
 void EventManager::unsubscribe(const std::string& event_type) {
-    if (listeners.find(event_type) != listeners.end()) {
-        listeners[event_type].clear();
+    EventId type = intern(event_type);
+    std::lock_guard<std::mutex> lock(mutex);
+    subscriptions.erase(type);
+}
+
+bool EventManager::publish(const Event& event) {
+    if (!queue.try_push(event)) {
+        dropped_events.fetch_add(1, std::memory_order_relaxed);
+        return false;
     }
+    return true;
 }
 
 void EventManager::notify(const std::string& event_type, double loss, size_t epoch) {
-    if (listeners.find(event_type) != listeners.end()) {
-        for (const auto& listener : listeners[event_type]) {
-            listener(loss, epoch);
+    publish(Event(intern(event_type), loss, epoch));
+}
+
+void EventManager::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    size_t target = queue.claimed();
+    flush_target = std::max(flush_target, target);
+    wake.notify_one();
+    drained.wait(lock, [this, target] { return flushed_through >= target; });
+}
+
+size_t EventManager::get_dropped_events() const {
+    return dropped_events.load(std::memory_order_relaxed);
+}
+
+void EventManager::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    Event event;
+
+    for (;;) {
+        while (queue.try_pop(event)) {
+            dispatch(event, std::chrono::steady_clock::now());
+            ++dispatched;
+        }
+
+        // Slots claimed before a flush (or shutdown) may still be being written; keep
+        // polling until they have all been delivered.
+        bool flush_pending = flushed_through < flush_target;
+        size_t target = stopping ? queue.claimed() : flush_target;
+        bool caught_up = dispatched >= target;
+        auto wait = deliver_pending(std::chrono::steady_clock::now(), (flush_pending || stopping) && caught_up);
+
+        if (flush_pending && caught_up) {
+            flushed_through = flush_target;
+            drained.notify_all();
+        }
+        if (stopping && caught_up) {
+            return;
+        }
+        if (!caught_up) {
+            wait = std::chrono::microseconds(50);
+        }
+
+        wake.wait_for(lock, wait);
+    }
+}
+
+void EventManager::dispatch(const Event& event, std::chrono::steady_clock::time_point now) {
+    auto it = subscriptions.find(event.type);
+    if (it == subscriptions.end()) {
+        return;
+    }
+
+    for (auto& subscription : it->second) {
+        if (now - subscription.last_delivery >= subscription.min_interval) {
+            subscription.listener(event);
+            subscription.last_delivery = now;
+            subscription.has_pending = false;
+        } else {
+            subscription.pending = event;
+            subscription.has_pending = true;
         }
     }
-}
\ No newline at end of file
+}
+
+std::chrono::steady_clock::duration EventManager::deliver_pending(std::chrono::steady_clock::time_point now, bool force) {
+    std::chrono::steady_clock::duration wait = poll_interval;
+
+    for (auto& entry : subscriptions) {
+        for (auto& subscription : entry.second) {
+            if (!subscription.has_pending) {
+                continue;
+            }
+            auto due = subscription.last_delivery + subscription.min_interval;
+            if (force || now >= due) {
+                subscription.listener(subscription.pending);
+                subscription.last_delivery = now;
+                subscription.has_pending = false;
+            } else {
+                wait = std::min<std::chrono::steady_clock::duration>(wait, due - now);
+            }
+        }
+    }
+    return wait;
+}
@@ -1,27 +1,198 @@
 #ifndef EVENTMANAGER_H
 #define EVENTMANAGER_H
 
-#include <vector>
-#include <unordered_map>
-#include <string>
+#include "MpscQueue.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
-#include <utility>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Interned event or metric name; see EventManager::intern.
+ */
+using EventId = uint32_t;
+
+/**
+ * @brief Handle returned by EventManager::subscribe.
+ */
+using SubscriptionId = size_t;
+
+/**
+ * @struct Event
+ * @brief Payload delivered to listeners. Fixed size, so publishing never allocates.
+ */
+struct Event {
+    static constexpr size_t MAX_METRICS = 8;
+
+    /**
+     * @struct Metric
+     * @brief Additional named value carried by an event.
+     */
+    struct Metric {
+        EventId name;
+        double value;
+    };
+
+    EventId type = 0;
+    double value = 0.0;
+    size_t epoch = 0;
+    size_t step = 0;
+    std::chrono::steady_clock::time_point timestamp;
+    std::array<Metric, MAX_METRICS> metrics{};
+    size_t metric_count = 0;
+
+    Event() = default;
+
+    /**
+     * @brief Constructor for Event; timestamps the event with the current time.
+     * @param type The event type.
+     * @param value The main value (e.g. the loss).
+     * @param epoch The epoch the event belongs to.
+     * @param step The optimizer step within the epoch (0 for epoch-level events).
+     */
+    Event(EventId type, double value, size_t epoch = 0, size_t step = 0);
+
+    /**
+     * @brief Attaches a named metric.
+     * @param name Interned metric name.
+     * @param metric_value The metric value.
+     * @return This event, for chaining.
+     * @throws std::length_error if MAX_METRICS metrics are already attached.
+     */
+    Event& add_metric(EventId name, double metric_value);
+
+    /**
+     * @brief Looks up an attached metric.
+     * @param name Interned metric name.
+     * @param fallback Returned when the metric is not attached.
+     * @return The metric value or fallback.
+     */
+    double get_metric(EventId name, double fallback = 0.0) const;
+};
 
 /**
  * @class EventManager
- * @brief Base class for managing event subscriptions and notifications.
+ * @brief Asynchronous event bus with interned event types.
+ *
+ * publish() copies the event into a bounded lock-free queue and returns immediately; a
+ * dispatcher thread owned by the manager invokes the listeners. Publishers never take a
+ * lock, perform I/O or wait for listeners, and when the queue is full the event is dropped
+ * and counted instead of blocking. Listeners run one at a time on the dispatcher thread,
+ * in publication order per publisher.
+ *
+ * A subscription may set a minimum interval between deliveries. Events arriving sooner
+ * are coalesced: only the latest one is kept and delivered when the interval elapses (or
+ * on flush), so a slow listener sees the most recent state rather than a backlog.
  */
 class EventManager {
+public:
+    using Listener = std::function<void(const Event&)>;
+
 private:
-    std::unordered_map<std::string, std::vector<std::function<void(double, size_t)>>> listeners;
+    struct Subscription {
+        SubscriptionId id;
+        Listener listener;
+        std::chrono::steady_clock::duration min_interval;
+        std::chrono::steady_clock::time_point last_delivery;
+        bool has_pending = false;
+        Event pending;
+    };
+
+    MpscQueue<Event> queue;
+    std::chrono::milliseconds poll_interval;
+    std::atomic<size_t> dropped_events{0};
+
+    // Everything below is guarded by mutex; the dispatcher holds it while delivering.
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable drained;
+    std::unordered_map<EventId, std::vector<Subscription>> subscriptions;
+    SubscriptionId next_subscription = 1;
+    size_t dispatched = 0;
+    size_t flush_target = 0;
+    size_t flushed_through = 0;
+    bool stopping = false;
+
+    std::thread dispatcher;
+
+    /**
+     * @brief Dispatcher thread body.
+     */
+    void run();
+
+    /**
+     * @brief Delivers one event to its subscribers, honouring their rate limits.
+     */
+    void dispatch(const Event& event, std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief Delivers coalesced events whose interval elapsed (all of them if force is set).
+     * @return Time until the earliest remaining pending delivery, or poll_interval.
+     */
+    std::chrono::steady_clock::duration deliver_pending(std::chrono::steady_clock::time_point now, bool force);
 
 public:
+    /**
+     * @brief Constructor for EventManager; starts the dispatcher thread.
+     * @param queue_capacity Events that can be queued before publish starts dropping.
+     * @param poll_interval How often the dispatcher checks the queue when idle.
+     */
+    explicit EventManager(size_t queue_capacity = 4096,
+                          std::chrono::milliseconds poll_interval = std::chrono::milliseconds(5));
+
+    /**
+     * @brief Delivers every queued and coalesced event, then stops the dispatcher.
+     */
+    ~EventManager();
+
+    EventManager(const EventManager&) = delete;
+    EventManager& operator=(const EventManager&) = delete;
+
+    /**
+     * @brief Returns the process-wide ID of an event or metric name, registering it if new.
+     * Resolve names once (at subscribe time or in a constant) and publish with the ID.
+     * @param name The name.
+     * @return The interned ID.
+     */
+    static EventId intern(const std::string& name);
+
+    /**
+     * @brief Returns the name an ID was interned from.
+     * @throws std::out_of_range if the ID was never interned.
+     */
+    static const std::string& name_of(EventId id);
+
+    /**
+     * @brief Subscribes a listener to an event type.
+     * The listener runs on the dispatcher thread; it must not throw or (un)subscribe.
+     * @param type The event type.
+     * @param listener The listener callback.
+     * @param min_interval Minimum time between deliveries; faster events are coalesced.
+     * @return Handle for unsubscribe.
+     */
+    SubscriptionId subscribe(EventId type, Listener listener,
+                             std::chrono::milliseconds min_interval = std::chrono::milliseconds(0));
+
     /**
      * @brief Subscribes a listener to a specific event type.
      * @param event_type The event type to subscribe to.
-     * @param listener The listener callback to add.
+     * @param listener The listener callback to add; receives the event value and epoch.
+     * @return Handle for unsubscribe.
+     */
+    SubscriptionId subscribe(const std::string& event_type, const std::function<void(double, size_t)>& listener);
+
+    /**
+     * @brief Removes one subscription.
+     * @param id The handle returned by subscribe.
      */
-    void subscribe(const std::string& event_type, const std::function<void(double, size_t)>& listener);
+    void unsubscribe(SubscriptionId id);
 
     /**
      * @brief Unsubscribes all listeners from a specific event type.
@@ -30,12 +201,30 @@ public:
     void unsubscribe(const std::string& event_type);
 
     /**
-     * @brief Notifies all listeners of a specific event type with the provided data.
+     * @brief Queues an event for delivery without blocking.
+     * @param event The event.
+     * @return False if the queue was full and the event was dropped.
+     */
+    bool publish(const Event& event);
+
+    /**
+     * @brief Queues an event built from a value and an epoch.
      * @param event_type The event type to notify.
      * @param loss The loss value to pass to the listeners.
      * @param epoch The epoch value to pass to the listeners.
      */
     void notify(const std::string& event_type, double loss, size_t epoch);
+
+    /**
+     * @brief Blocks until every event published before the call has been delivered,
+     * including coalesced events still waiting for their interval.
+     */
+    void flush();
+
+    /**
+     * @brief Returns how many events were dropped because the queue was full.
+     */
+    size_t get_dropped_events() const;
 };
 
-#endif // EVENTMANAGER_H
\ No newline at end of file
+#endif // EVENTMANAGER_H
@@ -0,0 +1,136 @@
+#include "GradientSynchronizer.h"
+#include <stdexcept>
+
+GradientSynchronizer::GradientSynchronizer(std::shared_ptr<Communicator> communicator, size_t bucket_size)
+    : communicator(std::move(communicator)), bucket_size(bucket_size) {
+    if (!this->communicator) {
+        throw std::invalid_argument("GradientSynchronizer needs a communicator.");
+    }
+    worker = std::thread(&GradientSynchronizer::run, this);
+}
+
+GradientSynchronizer::~GradientSynchronizer() {
+    detach();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    work_ready.notify_one();
+    worker.join();
+}
+
+void GradientSynchronizer::attach(Sequential& target) {
+    if (target.has_sparse_parameters()) {
+        throw std::invalid_argument("Distributed training does not support parameters outside the parameter store (e.g. Embedding).");
+    }
+    detach();
+    model = &target;
+    model->set_gradient_hook([this](size_t index) { module_ready(index); });
+
+    ParameterView values = model->parameters();
+    communicator->broadcast(values.data, values.size, 0);
+    model->refresh_parameters();
+}
+
+void GradientSynchronizer::detach() {
+    if (model) {
+        model->set_gradient_hook(nullptr);
+        model = nullptr;
+    }
+}
+
+void GradientSynchronizer::begin_step() {
+    armed = true;
+}
+
+void GradientSynchronizer::module_ready(size_t index) {
+    if (!armed) {
+        return;
+    }
+
+    ParameterView gradients = model->get_modules()[index]->gradients();
+    if (gradients.size == 0) {
+        return;
+    }
+
+    // Modules finish last to first, so a module's gradients directly precede the bucket.
+    if (bucket_begin && gradients.end() != bucket_begin) {
+        submit_bucket();
+    }
+    if (!bucket_begin) {
+        bucket_end = gradients.end();
+    }
+    bucket_begin = gradients.begin();
+
+    if (static_cast<size_t>(bucket_end - bucket_begin) >= bucket_size) {
+        submit_bucket();
+    }
+}
+
+void GradientSynchronizer::submit_bucket() {
+    if (!bucket_begin) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        buckets.push_back({bucket_begin, static_cast<size_t>(bucket_end - bucket_begin)});
+        ++in_flight;
+    }
+    work_ready.notify_one();
+    bucket_begin = nullptr;
+    bucket_end = nullptr;
+}
+
+void GradientSynchronizer::finish_step() {
+    if (!armed) {
+        return;
+    }
+    submit_bucket();
+    armed = false;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    work_done.wait(lock, [this] { return in_flight == 0; });
+    if (error) {
+        std::exception_ptr failure = error;
+        error = nullptr;
+        std::rethrow_exception(failure);
+    }
+}
+
+long double GradientSynchronizer::average(long double value) {
+    communicator->all_reduce_mean(&value, 1);
+    return value;
+}
+
+Communicator& GradientSynchronizer::get_communicator() const {
+    return *communicator;
+}
+
+void GradientSynchronizer::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        work_ready.wait(lock, [this] { return stopping || !buckets.empty(); });
+        if (buckets.empty()) {
+            return;
+        }
+
+        ParameterView bucket = buckets.front();
+        buckets.pop_front();
+        lock.unlock();
+
+        std::exception_ptr failure;
+        try {
+            communicator->all_reduce_mean(bucket.data, bucket.size);
+        } catch (...) {
+            failure = std::current_exception();
+        }
+
+        lock.lock();
+        if (failure && !error) {
+            error = failure;
+        }
+        if (--in_flight == 0) {
+            work_done.notify_all();
+        }
+    }
+}
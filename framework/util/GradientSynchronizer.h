@@ -0,0 +1,114 @@
+#ifndef GRADIENTSYNCHRONIZER_H
+#define GRADIENTSYNCHRONIZER_H
+
+#include "Communicator.h"
+#include "SequentialNN.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @class GradientSynchronizer
+ * @brief Averages a model's gradients over all ranks, overlapping communication with backward.
+ *
+ * Attached to a Sequential through its gradient hook. During an armed backward pass each
+ * module reports its gradients as soon as they are complete; neighbouring modules are
+ * merged into contiguous buckets of the parameter store, and every full bucket is
+ * all-reduced on a communication thread while backward continues with the earlier modules.
+ * finish_step waits for the outstanding buckets before the optimizer runs.
+ *
+ * Only gradients in the model's parameter store are averaged, so models with parameters
+ * outside it (Embedding tables) are rejected: their replicas would drift apart.
+ */
+class GradientSynchronizer {
+private:
+    std::shared_ptr<Communicator> communicator;
+    size_t bucket_size;
+    Sequential* model = nullptr;
+
+    bool armed = false;
+    long double* bucket_begin = nullptr;
+    long double* bucket_end = nullptr;
+
+    std::mutex mutex;
+    std::condition_variable work_ready;
+    std::condition_variable work_done;
+    std::deque<ParameterView> buckets;
+    size_t in_flight = 0;
+    bool stopping = false;
+    std::exception_ptr error;
+    std::thread worker;
+
+    /**
+     * @brief Gradient hook: adds a finished module to the current bucket.
+     */
+    void module_ready(size_t index);
+
+    /**
+     * @brief Hands the current bucket to the communication thread.
+     */
+    void submit_bucket();
+
+    /**
+     * @brief Communication thread body.
+     */
+    void run();
+
+public:
+    /**
+     * @brief Constructor for GradientSynchronizer.
+     * @param communicator The ranks to average over.
+     * @param bucket_size Minimum number of gradients per all-reduce.
+     */
+    explicit GradientSynchronizer(std::shared_ptr<Communicator> communicator, size_t bucket_size = 16384);
+
+    /**
+     * @brief Detaches from the model and stops the communication thread.
+     */
+    ~GradientSynchronizer();
+
+    GradientSynchronizer(const GradientSynchronizer&) = delete;
+    GradientSynchronizer& operator=(const GradientSynchronizer&) = delete;
+
+    /**
+     * @brief Installs the gradient hook and broadcasts rank 0's parameters to every rank.
+     * Collective: every rank must call it.
+     * @param target The model being trained; must outlive the synchronizer or be detached.
+     * @throws std::invalid_argument if the model has parameters outside its store.
+     */
+    void attach(Sequential& target);
+
+    /**
+     * @brief Removes the gradient hook.
+     */
+    void detach();
+
+    /**
+     * @brief Makes the next backward pass reduce its gradients; call before the last
+     * backward of an accumulation window.
+     */
+    void begin_step();
+
+    /**
+     * @brief Reduces what is left of the armed backward pass and waits for every bucket.
+     * @throws std::runtime_error (or the transport's exception) if communication failed.
+     */
+    void finish_step();
+
+    /**
+     * @brief Averages a scalar over all ranks; only call between steps.
+     * @param value The local value.
+     * @return The mean over all ranks.
+     */
+    long double average(long double value);
+
+    /**
+     * @brief Returns the communicator.
+     */
+    Communicator& get_communicator() const;
+};
+
+#endif // GRADIENTSYNCHRONIZER_H
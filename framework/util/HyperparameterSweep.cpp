@@ -0,0 +1,243 @@
+#include "HyperparameterSweep.h"
+#include "ThreadPool.h"
+#include "LearningFacade.h"
+#include "LinearLayer.h"
+#include "ActivationLayer.h"
+#include "Evaluator.h"
+#include "SGD.h"
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief A model being trained, carried from one halving round to the next.
+     */
+    struct Trial {
+        Sequential model;
+        std::unique_ptr<SGD> optimizer;
+        TrialResult result;
+    };
+
+    std::shared_ptr<ActivationLayer> make_activation(ActivationKind kind) {
+        switch (kind) {
+            case ActivationKind::Identity:
+                return std::make_shared<ActivationLayer>(Activations::identity, Activations::identity_derivative);
+            case ActivationKind::ReLU:
+                return std::make_shared<ActivationLayer>(Activations::relu, Activations::relu_derivative);
+            case ActivationKind::Sigmoid:
+                return std::make_shared<ActivationLayer>(Activations::sigmoid, Activations::sigmoid_derivative);
+            case ActivationKind::Tanh:
+                return std::make_shared<ActivationLayer>(Activations::tanh, Activations::tanh_derivative);
+            default:
+                throw std::invalid_argument("Sweeps only support the built-in activations.");
+        }
+    }
+
+    const char* activation_name(ActivationKind kind) {
+        switch (kind) {
+            case ActivationKind::Identity: return "identity";
+            case ActivationKind::ReLU: return "relu";
+            case ActivationKind::Sigmoid: return "sigmoid";
+            case ActivationKind::Tanh: return "tanh";
+            default: return "custom";
+        }
+    }
+
+    std::string layers_name(const std::vector<size_t>& hidden_layers) {
+        std::ostringstream name;
+        for (size_t i = 0; i < hidden_layers.size(); ++i) {
+            name << (i ? "-" : "") << hidden_layers[i];
+        }
+        return hidden_layers.empty() ? "none" : name.str();
+    }
+
+    void check_space(const SweepSpace& space) {
+        if (space.hidden_layers.empty() || space.activations.empty() ||
+            space.learning_rates.empty() || space.epochs.empty()) {
+            throw std::invalid_argument("Every hyperparameter of the sweep space needs at least one value.");
+        }
+    }
+
+    /**
+     * @brief Better-first ordering: completed trials by loss, then pruned ones by progress.
+     */
+    bool ranks_before(const TrialResult& a, const TrialResult& b) {
+        if (a.pruned != b.pruned) {
+            return !a.pruned;
+        }
+        if (a.pruned && a.epochs_trained != b.epochs_trained) {
+            return a.epochs_trained > b.epochs_trained;
+        }
+        return a.validation_loss < b.validation_loss;
+    }
+}
+
+HyperparameterSweep::HyperparameterSweep(const DataFrame& train_data, const DataFrame& train_target,
+                                         const DataFrame& validation_data, const DataFrame& validation_target,
+                                         std::shared_ptr<LossFunction> loss_function, size_t num_threads)
+    : train_data(train_data), train_target(train_target), validation_data(validation_data),
+      validation_target(validation_target), loss_function(std::move(loss_function)), num_threads(num_threads) {}
+
+void HyperparameterSweep::set_successive_halving(size_t min_epochs, size_t reduction_factor) {
+    if (reduction_factor < 2) {
+        throw std::invalid_argument("reduction_factor must be at least 2.");
+    }
+    this->min_epochs = min_epochs;
+    this->reduction_factor = reduction_factor;
+}
+
+std::vector<TrialConfig> HyperparameterSweep::grid(const SweepSpace& space) {
+    check_space(space);
+    std::vector<TrialConfig> configs;
+    for (const auto& layers : space.hidden_layers) {
+        for (ActivationKind activation : space.activations) {
+            for (long double learning_rate : space.learning_rates) {
+                for (size_t epochs : space.epochs) {
+                    configs.push_back({layers, activation, learning_rate, epochs});
+                }
+            }
+        }
+    }
+    return configs;
+}
+
+std::vector<TrialConfig> HyperparameterSweep::random(const SweepSpace& space, size_t count, uint32_t seed) {
+    check_space(space);
+    std::mt19937 generator(seed);
+    auto pick = [&generator](const auto& values) {
+        std::uniform_int_distribution<size_t> index(0, values.size() - 1);
+        return values[index(generator)];
+    };
+
+    std::vector<TrialConfig> configs;
+    configs.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        TrialConfig config;
+        config.hidden_layers = pick(space.hidden_layers);
+        config.activation = pick(space.activations);
+        config.learning_rate = pick(space.learning_rates);
+        config.epochs = pick(space.epochs);
+        configs.push_back(std::move(config));
+    }
+    return configs;
+}
+
+std::vector<TrialResult> HyperparameterSweep::run(const std::vector<TrialConfig>& configs) const {
+    size_t inputs = train_data.column_count();
+    size_t outputs = train_target.column_count();
+
+    std::vector<Trial> trials(configs.size());
+    for (size_t i = 0; i < configs.size(); ++i) {
+        const TrialConfig& config = configs[i];
+        if (config.epochs == 0) {
+            throw std::invalid_argument("Every trial needs at least one epoch.");
+        }
+        size_t width = inputs;
+        for (size_t hidden : config.hidden_layers) {
+            trials[i].model.add_module(std::make_shared<LinearLayer>(width, hidden));
+            trials[i].model.add_module(make_activation(config.activation));
+            width = hidden;
+        }
+        trials[i].model.add_module(std::make_shared<LinearLayer>(width, outputs));
+        trials[i].optimizer = std::make_unique<SGD>(config.learning_rate);
+        trials[i].result.config = config;
+    }
+
+    // Trains a trial up to the budget (or its own epochs) and validates it.
+    auto train_to = [this](Trial& trial, size_t budget) {
+        size_t target_epochs = std::min(budget, trial.result.config.epochs);
+        if (trial.result.epochs_trained >= target_epochs) {
+            return;
+        }
+        auto start = std::chrono::steady_clock::now();
+
+        LearningFacade facade(trial.model, loss_function, target_epochs - trial.result.epochs_trained);
+        facade.set_terminal_display(false);
+        auto train_loader = train_data.create_iterator();
+        auto target_loader = train_target.create_iterator();
+        facade.train(*train_loader, *target_loader, *trial.optimizer);
+
+        auto validation_loader = validation_data.create_iterator();
+        auto validation_target_loader = validation_target.create_iterator();
+        EvaluationResults evaluation = Evaluator(loss_function, 1).evaluate(
+            trial.model, *validation_loader, *validation_target_loader);
+
+        trial.result.epochs_trained = target_epochs;
+        trial.result.validation_loss = evaluation.loss;
+        trial.result.validation_accuracy = evaluation.accuracy;
+        trial.result.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    ThreadPool pool(num_threads);
+    std::vector<Trial*> active;
+    for (auto& trial : trials) {
+        active.push_back(&trial);
+    }
+
+    size_t budget = min_epochs > 0 ? min_epochs : SIZE_MAX;
+    while (!active.empty()) {
+        std::vector<std::future<void>> pending;
+        for (Trial* trial : active) {
+            pending.push_back(pool.submit([&train_to, trial, budget] { train_to(*trial, budget); }));
+        }
+        for (auto& future : pending) {
+            future.get();
+        }
+
+        // Trials that reached their own epochs are complete; only the others compete for budget.
+        active.erase(std::remove_if(active.begin(), active.end(), [](const Trial* trial) {
+            return trial->result.epochs_trained == trial->result.config.epochs;
+        }), active.end());
+        if (active.empty()) {
+            break;
+        }
+
+        std::sort(active.begin(), active.end(), [](const Trial* a, const Trial* b) {
+            return a->result.validation_loss < b->result.validation_loss;
+        });
+        size_t kept = (active.size() + reduction_factor - 1) / reduction_factor;
+        for (size_t i = kept; i < active.size(); ++i) {
+            active[i]->result.pruned = true;
+        }
+        active.resize(kept);
+        budget = budget > SIZE_MAX / reduction_factor ? SIZE_MAX : budget * reduction_factor;
+    }
+
+    std::vector<TrialResult> results;
+    results.reserve(trials.size());
+    for (const auto& trial : trials) {
+        results.push_back(trial.result);
+    }
+    std::stable_sort(results.begin(), results.end(), ranks_before);
+    return results;
+}
+
+void HyperparameterSweep::print_results(const std::vector<TrialResult>& results, std::ostream& out) {
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    out << std::left << std::setw(6) << "Rank" << std::setw(16) << "Layers" << std::setw(10) << "Act"
+        << std::setw(12) << "LR" << std::setw(10) << "Epochs" << std::setw(14) << "Val loss"
+        << std::setw(12) << "Val acc %" << std::setw(10) << "Seconds" << "Status\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const TrialResult& result = results[i];
+        std::ostringstream epochs;
+        epochs << result.epochs_trained << "/" << result.config.epochs;
+        out << std::left << std::setw(6) << i + 1 << std::setw(16) << layers_name(result.config.hidden_layers)
+            << std::setw(10) << activation_name(result.config.activation)
+            << std::setw(12) << std::defaultfloat << std::setprecision(4) << static_cast<double>(result.config.learning_rate)
+            << std::setw(10) << epochs.str()
+            << std::setw(14) << std::fixed << std::setprecision(6) << static_cast<double>(result.validation_loss)
+            << std::setw(12) << std::setprecision(2) << static_cast<double>(result.validation_accuracy)
+            << std::setw(10) << std::setprecision(2) << result.seconds
+            << (result.pruned ? "pruned" : "complete") << "\n";
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
@@ -0,0 +1,129 @@
+#ifndef HYPERPARAMETERSWEEP_H
+#define HYPERPARAMETERSWEEP_H
+
+#include "DataFrame.h"
+#include "LossFunction.h"
+#include "Activations.h"
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/**
+ * @struct SweepSpace
+ * @brief Candidate values of every hyperparameter searched by HyperparameterSweep.
+ */
+struct SweepSpace {
+    std::vector<std::vector<size_t>> hidden_layers;   ///< Hidden layer widths, e.g. {64, 32}.
+    std::vector<ActivationKind> activations;          ///< Activation after every hidden layer.
+    std::vector<long double> learning_rates;
+    std::vector<size_t> epochs;                       ///< Maximum number of epochs.
+};
+
+/**
+ * @struct TrialConfig
+ * @brief One point of the search space.
+ */
+struct TrialConfig {
+    std::vector<size_t> hidden_layers;
+    ActivationKind activation = ActivationKind::ReLU;
+    long double learning_rate = 0.01L;
+    size_t epochs = 10;
+};
+
+/**
+ * @struct TrialResult
+ * @brief Outcome of one trial, as returned by HyperparameterSweep::run.
+ */
+struct TrialResult {
+    TrialConfig config;
+    size_t epochs_trained = 0;
+    long double validation_loss = 0.0L;
+    long double validation_accuracy = 0.0L;   ///< In percent.
+    bool pruned = false;                      ///< Stopped early by successive halving.
+    double seconds = 0.0;                     ///< Training and validation time.
+};
+
+/**
+ * @class HyperparameterSweep
+ * @brief Trains many small models concurrently on one shared dataset and ranks them.
+ *
+ * Every trial builds its own Sequential (linear layers of the configured widths with the
+ * configured activation in between, and a linear output layer sized by the target) and
+ * trains it with plain SGD. Trials run on a thread pool with one worker per core, each
+ * trial on a single thread, so a machine is kept busy by models too small to use more than
+ * one core each. All trials read the same DataFrames, which are never copied or modified.
+ *
+ * With successive halving enabled, all trials first train for min_epochs. Trials that have
+ * reached their configured epochs are then complete; the others are ranked by validation
+ * loss, only the best 1 / reduction_factor of them continue, and the budget is multiplied
+ * by reduction_factor, until the survivors reach their configured epochs.
+ */
+class HyperparameterSweep {
+private:
+    const DataFrame& train_data;
+    const DataFrame& train_target;
+    const DataFrame& validation_data;
+    const DataFrame& validation_target;
+    std::shared_ptr<LossFunction> loss_function;
+    size_t num_threads;
+    size_t min_epochs = 0;
+    size_t reduction_factor = 3;
+
+public:
+    /**
+     * @brief Constructor for HyperparameterSweep.
+     * The DataFrames are referenced, not copied, and must outlive the sweep.
+     * @param train_data Training data.
+     * @param train_target Training target.
+     * @param validation_data Validation data used to rank the trials.
+     * @param validation_target Validation target.
+     * @param loss_function The loss function used for training and ranking.
+     * @param num_threads Number of trials trained at once (0 uses every hardware thread).
+     */
+    HyperparameterSweep(const DataFrame& train_data, const DataFrame& train_target,
+                        const DataFrame& validation_data, const DataFrame& validation_target,
+                        std::shared_ptr<LossFunction> loss_function, size_t num_threads = 0);
+
+    /**
+     * @brief Enables successive halving.
+     * @param min_epochs Epochs every trial trains before the first pruning (0 disables halving).
+     * @param reduction_factor Fraction of trials kept, and growth of the budget, per round.
+     * @throws std::invalid_argument if reduction_factor is smaller than 2.
+     */
+    void set_successive_halving(size_t min_epochs, size_t reduction_factor = 3);
+
+    /**
+     * @brief Returns every combination of the values in the space.
+     * @param space The search space; every list must be non-empty.
+     * @throws std::invalid_argument if a list is empty.
+     */
+    static std::vector<TrialConfig> grid(const SweepSpace& space);
+
+    /**
+     * @brief Draws configurations uniformly from the space.
+     * @param space The search space; every list must be non-empty.
+     * @param count Number of configurations.
+     * @param seed Seed of the draw, for repeatable sweeps.
+     * @throws std::invalid_argument if a list is empty.
+     */
+    static std::vector<TrialConfig> random(const SweepSpace& space, size_t count, uint32_t seed = 42);
+
+    /**
+     * @brief Trains and validates every configuration.
+     * @param configs The trials to run.
+     * @return One result per trial, best first: completed trials by validation loss,
+     * then pruned trials by how far they got.
+     * @throws std::invalid_argument if a configuration has a Custom activation or zero epochs.
+     */
+    std::vector<TrialResult> run(const std::vector<TrialConfig>& configs) const;
+
+    /**
+     * @brief Prints results as a ranked table.
+     * @param results Results returned by run.
+     * @param out Output stream.
+     */
+    static void print_results(const std::vector<TrialResult>& results, std::ostream& out = std::cout);
+};
+
+#endif // HYPERPARAMETERSWEEP_H
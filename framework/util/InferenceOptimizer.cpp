@@ -0,0 +1,184 @@
+#include "InferenceOptimizer.h"
+#include "LinearLayer.h"
+#include "ActivationLayer.h"
+#include "AffineLayer.h"
+#include "PackedLinearLayer.h"
+#include <stdexcept>
+
+namespace {
+    enum class StageKind { Linear, Affine, Other };
+
+    // Linear: weights [output][input] and biases; Affine: weights = scale, biases = shift.
+    struct Stage {
+        StageKind kind;
+        size_t input_size = 0;
+        size_t output_size = 0;
+        std::vector<long double> weights;
+        std::vector<long double> biases;
+        std::shared_ptr<Module> module;
+    };
+
+    void flatten(const Sequential& model, std::vector<std::shared_ptr<Module>>& modules) {
+        for (const auto& module : model.get_modules()) {
+            if (const auto* nested = dynamic_cast<const Sequential*>(module.get())) {
+                flatten(*nested, modules);
+            } else {
+                modules.push_back(module);
+            }
+        }
+    }
+
+    bool is_noop(const Module& module) {
+        if (const auto* activation = dynamic_cast<const ActivationLayer*>(&module)) {
+            return activation->kind() == ActivationKind::Identity;
+        }
+        if (const auto* affine = dynamic_cast<const AffineLayer*>(&module)) {
+            return affine->is_identity();
+        }
+        return false;
+    }
+
+    Stage to_stage(const std::shared_ptr<Module>& module) {
+        Stage stage;
+        if (const auto* linear = dynamic_cast<const LinearLayer*>(module.get())) {
+            stage.kind = StageKind::Linear;
+            stage.input_size = linear->get_input_size();
+            stage.output_size = linear->get_output_size();
+            stage.weights.assign(linear->get_weights().begin(), linear->get_weights().end());
+            stage.biases.assign(linear->get_biases().begin(), linear->get_biases().end());
+        } else if (const auto* affine = dynamic_cast<const AffineLayer*>(module.get())) {
+            stage.kind = StageKind::Affine;
+            stage.input_size = stage.output_size = affine->get_scale().size();
+            stage.weights = affine->get_scale();
+            stage.biases = affine->get_shift();
+        } else {
+            stage.kind = StageKind::Other;
+            stage.module = module;
+        }
+        return stage;
+    }
+
+    void check_chain(const Stage& previous, const Stage& next) {
+        if (previous.output_size != next.input_size) {
+            throw std::invalid_argument("Layer sizes of the model do not chain.");
+        }
+    }
+
+    // Replaces previous with previous followed by next; returns false if they cannot be folded.
+    bool try_fold(Stage& previous, const Stage& next) {
+        if (previous.kind == StageKind::Other || next.kind == StageKind::Other) {
+            return false;
+        }
+        check_chain(previous, next);
+
+        if (previous.kind == StageKind::Affine && next.kind == StageKind::Affine) {
+            for (size_t i = 0; i < previous.output_size; ++i) {
+                previous.weights[i] *= next.weights[i];
+                previous.biases[i] = previous.biases[i] * next.weights[i] + next.biases[i];
+            }
+            return true;
+        }
+
+        if (previous.kind == StageKind::Affine) {
+            // W (x * s + t) + b = (W diag(s)) x + (W t + b)
+            Stage folded = next;
+            for (size_t i = 0; i < next.output_size; ++i) {
+                for (size_t j = 0; j < next.input_size; ++j) {
+                    long double w = next.weights[i * next.input_size + j];
+                    folded.weights[i * next.input_size + j] = w * previous.weights[j];
+                    folded.biases[i] += w * previous.biases[j];
+                }
+            }
+            previous = std::move(folded);
+            return true;
+        }
+
+        if (next.kind == StageKind::Affine) {
+            // (W x + b) * s + t = (diag(s) W) x + (b * s + t)
+            for (size_t i = 0; i < previous.output_size; ++i) {
+                for (size_t j = 0; j < previous.input_size; ++j) {
+                    previous.weights[i * previous.input_size + j] *= next.weights[i];
+                }
+                previous.biases[i] = previous.biases[i] * next.weights[i] + next.biases[i];
+            }
+            return true;
+        }
+
+        // W2 (W1 x + b1) + b2 = (W2 W1) x + (W2 b1 + b2), only when it does not grow the model
+        size_t merged = next.output_size * previous.input_size;
+        size_t separate = previous.output_size * previous.input_size + next.output_size * next.input_size;
+        if (merged > separate) {
+            return false;
+        }
+
+        Stage folded;
+        folded.kind = StageKind::Linear;
+        folded.input_size = previous.input_size;
+        folded.output_size = next.output_size;
+        folded.weights.assign(merged, 0.0L);
+        folded.biases = next.biases;
+        for (size_t i = 0; i < next.output_size; ++i) {
+            long double* row = folded.weights.data() + i * folded.input_size;
+            for (size_t k = 0; k < next.input_size; ++k) {
+                long double w = next.weights[i * next.input_size + k];
+                const long double* inner = previous.weights.data() + k * previous.input_size;
+                for (size_t j = 0; j < previous.input_size; ++j) {
+                    row[j] += w * inner[j];
+                }
+                folded.biases[i] += w * previous.biases[k];
+            }
+        }
+        previous = std::move(folded);
+        return true;
+    }
+}
+
+InferenceOptimizer::InferenceOptimizer(bool pack_weights) : pack_weights(pack_weights) {}
+
+Sequential InferenceOptimizer::optimize(const Sequential& model) const {
+    std::vector<std::shared_ptr<Module>> modules;
+    flatten(model, modules);
+
+    std::vector<Stage> stages;
+    for (const auto& module : modules) {
+        if (is_noop(*module)) {
+            continue;
+        }
+        Stage stage = to_stage(module);
+        if (stages.empty() || !try_fold(stages.back(), stage)) {
+            stages.push_back(std::move(stage));
+        }
+    }
+
+    Sequential optimized;
+    for (size_t s = 0; s < stages.size(); ++s) {
+        const Stage& stage = stages[s];
+
+        if (stage.kind == StageKind::Other) {
+            optimized.add_module(stage.module->clone());
+        } else if (stage.kind == StageKind::Affine) {
+            auto affine = std::make_shared<AffineLayer>(stage.weights, stage.biases);
+            if (!affine->is_identity()) {
+                optimized.add_module(affine);
+            }
+        } else if (pack_weights) {
+            ActivationKind activation = ActivationKind::Identity;
+            if (s + 1 < stages.size() && stages[s + 1].kind == StageKind::Other) {
+                const auto* next = dynamic_cast<const ActivationLayer*>(stages[s + 1].module.get());
+                if (next && next->kind() != ActivationKind::Custom) {
+                    activation = next->kind();
+                    ++s;
+                }
+            }
+            optimized.add_module(std::make_shared<PackedLinearLayer>(
+                stage.weights, stage.biases, stage.input_size, activation));
+        } else {
+            auto linear = std::make_shared<LinearLayer>(stage.input_size, stage.output_size);
+            std::copy(stage.weights.begin(), stage.weights.end(), linear->get_weights().begin());
+            std::copy(stage.biases.begin(), stage.biases.end(), linear->get_biases().begin());
+            optimized.add_module(linear);
+        }
+    }
+
+    return optimized;
+}
@@ -0,0 +1,37 @@
+#ifndef INFERENCEOPTIMIZER_H
+#define INFERENCEOPTIMIZER_H
+
+#include "SequentialNN.h"
+
+/**
+ * @class InferenceOptimizer
+ * @brief Rewrites a trained model into an equivalent, cheaper model for scoring.
+ *
+ * The pass flattens nested Sequentials, drops no-op modules (identity activations and
+ * affine layers), folds AffineLayers such as input standardization into the adjacent
+ * LinearLayer, merges consecutive LinearLayers when the product is not larger than the
+ * pair, and finally packs the remaining linear layers into PackedLinearLayers with the
+ * following built-in activation fused in. Modules it does not understand are kept as
+ * clones, so the result never shares state with the source model.
+ */
+class InferenceOptimizer {
+private:
+    bool pack_weights;
+
+public:
+    /**
+     * @brief Constructor for InferenceOptimizer.
+     * @param pack_weights Emit PackedLinearLayers (inference-only) instead of LinearLayers.
+     */
+    explicit InferenceOptimizer(bool pack_weights = true);
+
+    /**
+     * @brief Builds the optimized version of a trained model.
+     * @param model The trained model; it is not modified.
+     * @return A new Sequential computing the same function.
+     * @throws std::invalid_argument if adjacent layer sizes do not chain.
+     */
+    Sequential optimize(const Sequential& model) const;
+};
+
+#endif // INFERENCEOPTIMIZER_H
@@ -3,13 +3,32 @@
 
 #include "SequentialNN.h"
 #include "DataFrameIterator.h"
+#include "SparseIterator.h"
 #include "LossPublisher.h"
 #include "TerminalLossDisplay.h"
 #include "LossFunction.h"
+#include "Optimizer.h"
+#include "SGD.h"
+#include "LossScaler.h"
+#include "Profiler.h"
+#include "Evaluator.h"
+#include "BackgroundValidator.h"
+#include "GradientSynchronizer.h"
 #include <memory>
 #include <iostream>
 #include <vector>
 #include <iomanip>
+#include <chrono>
+#include <stdexcept>
+
+/**
+ * @struct TestResults
+ * @brief Average loss and accuracy (in percent) measured by LearningFacade::test.
+ */
+struct TestResults {
+    long double loss;
+    long double accuracy;
+};
 
 /**
  * @class LearningFacade
@@ -21,102 +40,392 @@ private:
     std::shared_ptr<LossFunction> loss_function;
     LossPublisher loss_publisher;
     size_t total_epochs;
+    std::shared_ptr<BackgroundValidator> validator;
+    bool restore_best_weights = true;
+    std::shared_ptr<LossScaler> loss_scaler;
+    std::shared_ptr<GradientSynchronizer> synchronizer;
+    SubscriptionId display_subscription = 0;
 
     /**
-     * @brief Calculate accuracy based on a single prediction and target.
-     * @param prediction The model's prediction.
-     * @param target The ground truth label.
-     * @return 1.0 if correct, 0.0 otherwise.
+     * @brief Runs the training forward pass for a dense row.
      */
-    long double calculate_accuracy(long double prediction, long double target) const {
-        long double pred = prediction >= 0.5L ? 1.0L : 0.0L;
-        return pred == target ? 1.0L : 0.0L;
+    std::vector<long double> forward_input(const std::vector<long double>& input) {
+        return model.forward(input);
     }
 
-public:
     /**
-     * @brief Constructor for the LearningFacade.
-     * @param model The model to train and test.
-     * @param loss_function The loss function to use during training/testing.
-     * @param epochs The total number of training epochs.
+     * @brief Runs the training forward pass for a sparse row.
      */
-    LearningFacade(const Sequential& model, std::shared_ptr<LossFunction> loss_function, size_t epochs)
-        : model(model), loss_function(std::move(loss_function)), total_epochs(epochs) {
-        auto terminal_display = std::make_shared<TerminalLossDisplay>("Training Progress", total_epochs);
-        loss_publisher.get_event_manager().subscribe("loss_updated", [terminal_display](double loss, size_t epoch) {
-            terminal_display->update(loss, epoch);
-        });
+    std::vector<long double> forward_input(const SparseRow& input) {
+        return model.forward_sparse(input);
     }
 
     /**
-     * @brief Train the model with the given data and parameters.
-     * @param train_loader Training data loader.
-     * @param target_loader Target data loader.
-     * @param learning_rate Learning rate for training.
+     * @brief Returns the next row of a loader, timed as data fetch.
      */
-    void train(Iterator& train_loader, Iterator& target_loader, long double learning_rate) {
+    template <typename Loader>
+    static decltype(auto) fetch(Loader& loader) {
+        PROFILE_SCOPE(ProfilePhase::DataFetch);
+        return loader.get_next();
+    }
+
+    /**
+     * @brief Applies the accumulated gradients: the optimizer sweeps the flat store and
+     * modules with out-of-store parameters (embeddings) update the rows they touched.
+     * With loss scaling, overflowed steps are skipped and the scale is divided out.
+     */
+    void apply_step(Optimizer& optimizer, long double gradient_scale) {
+        PROFILE_SCOPE(ProfilePhase::Update);
+        if (synchronizer) {
+            synchronizer->finish_step();
+        }
+        if (loss_scaler) {
+            long double scale = loss_scaler->get_scale();
+            if (!loss_scaler->update(model.gradients(), model.sparse_gradients_finite())) {
+                model.update_sparse_parameters(0.0L);   // discards the pending rows
+                return;
+            }
+            gradient_scale /= scale;
+        }
+
+        optimizer.step(model.parameters(), model.gradients(), gradient_scale);
+        model.step_sparse_parameters(optimizer, gradient_scale);
+        model.refresh_parameters();
+    }
+
+    /**
+     * @brief Loss and timing of the samples accumulated since the last optimizer step.
+     */
+    struct StepWindow {
+        long double loss = 0.0L;
+        size_t samples = 0;
+        double fetch_seconds = 0.0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    };
+
+    /**
+     * @brief Applies one accumulation window, publishes its statistics and starts the next.
+     */
+    void finish_step(Optimizer& optimizer, StepWindow& window, size_t epoch, size_t step) {
+        apply_step(optimizer, 1.0L / window.samples);
+
+        PROFILE_SCOPE(ProfilePhase::Publish);
+        auto now = std::chrono::steady_clock::now();
+        loss_publisher.publish_batch_loss(static_cast<double>(window.loss / window.samples), epoch, step,
+                                          window.samples, std::chrono::duration<double>(now - window.start).count(),
+                                          window.fetch_seconds);
+        window = StepWindow();
+        window.start = now;
+    }
+
+    /**
+     * @brief Shared training loop for dense and sparse loaders.
+     */
+    template <typename Loader>
+    void run_training(Loader& train_loader, Iterator& target_loader, Optimizer& optimizer,
+                      size_t accumulation_steps) {
+        if (accumulation_steps == 0) {
+            throw std::invalid_argument("accumulation_steps must be at least 1.");
+        }
+
+        std::vector<long double> gradients;
+
         for (size_t epoch = 1; epoch <= total_epochs; ++epoch) {
             long double totalLoss = 0.0;
             size_t totalSamples = 0;
+            size_t step = 0;
+            StepWindow window;
 
             train_loader.reset();
             target_loader.reset();
 
             while (train_loader.has_more() && target_loader.has_more()) {
-                const auto& input = train_loader.get_next();
-                const auto& target = target_loader.get_next();
+                auto fetch_start = std::chrono::steady_clock::now();
+                const auto& input = fetch(train_loader);
+                const auto& target = fetch(target_loader);
+                window.fetch_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - fetch_start).count();
 
-                auto prediction = model.forward(input);
+                auto prediction = forward_input(input);
+                gradients.resize(prediction.size());
 
-                long double loss = loss_function->compute_loss({prediction[0]}, {target[0]});
+                long double loss;
+                {
+                    PROFILE_SCOPE(ProfilePhase::Loss);
+                    loss = loss_function->compute_loss_and_gradient(
+                        prediction.data(), target.data(), gradients.data(), 1, prediction.size());
+                }
                 totalLoss += loss;
+                window.loss += loss;
 
-                std::vector<long double> gradients(1);
-                gradients[0] = (prediction[0] - target[0]);
+                if (loss_scaler) {
+                    for (auto& g : gradients) {
+                        g *= loss_scaler->get_scale();
+                    }
+                }
 
+                bool last_in_window = window.samples + 1 == accumulation_steps ||
+                                      !(train_loader.has_more() && target_loader.has_more());
+                if (synchronizer && last_in_window) {
+                    synchronizer->begin_step();
+                }
                 model.backward(gradients);
-                model.update_parameters(learning_rate);
 
                 ++totalSamples;
+                if (++window.samples == accumulation_steps) {
+                    finish_step(optimizer, window, epoch, ++step);
+                }
+            }
+
+            if (window.samples > 0) {
+                finish_step(optimizer, window, epoch, ++step);
             }
 
             long double epochLoss = totalLoss / totalSamples;
-            loss_publisher.publish_loss(epochLoss, epoch);
+            if (synchronizer) {
+                epochLoss = synchronizer->average(epochLoss);
+            }
+            {
+                PROFILE_SCOPE(ProfilePhase::Publish);
+                loss_publisher.publish_loss(epochLoss, epoch);
+            }
+
+            if (validator) {
+                validator->submit(model, epoch);
+                bool stop = validator->should_stop();
+                if (synchronizer) {
+                    stop = synchronizer->average(stop ? 1.0L : 0.0L) > 0.0L;   // every rank stops together
+                }
+                if (stop) {
+                    break;
+                }
+            }
+        }
+
+        loss_publisher.flush();
+
+        if (validator) {
+            validator->finish();
+            if (restore_best_weights) {
+                validator->restore_best(model);
+            }
         }
     }
 
+public:
+    /**
+     * @brief Constructor for the LearningFacade.
+     * @param model The model to train and test.
+     * @param loss_function The loss function to use during training/testing.
+     * @param epochs The total number of training epochs.
+     */
+    LearningFacade(const Sequential& model, std::shared_ptr<LossFunction> loss_function, size_t epochs)
+        : model(model), loss_function(std::move(loss_function)), total_epochs(epochs) {
+        set_terminal_display(true);
+    }
 
+    /**
+     * @brief Shows or hides the terminal progress display (shown by default).
+     * Hide it when several facades train at the same time, since each one redraws the screen.
+     * @param enabled Whether epoch losses are drawn to the terminal.
+     */
+    void set_terminal_display(bool enabled) {
+        EventManager& events = loss_publisher.get_event_manager();
+        if (display_subscription != 0) {
+            events.unsubscribe(display_subscription);
+            display_subscription = 0;
+        }
+        if (!enabled) {
+            return;
+        }
+        // The display redraws the whole screen, so it is refreshed at most 20 times a second;
+        // epochs finishing faster are coalesced and the latest one is shown.
+        auto terminal_display = std::make_shared<TerminalLossDisplay>("Training Progress", total_epochs);
+        display_subscription = events.subscribe(LossPublisher::LOSS_UPDATED, [terminal_display](const Event& event) {
+            terminal_display->update(event.value, event.epoch);
+        }, std::chrono::milliseconds(50));
+    }
 
     /**
-     * @brief Test the model and compute accuracy.
+     * @brief Validate on a held-out set after every training epoch, on a background thread.
+     * Training of the next epoch overlaps with validation of a snapshot of the previous one.
+     * @param validation_loader Validation data loader.
+     * @param target_loader Validation target loader.
+     * @param patience Stop training after this many epochs without a lower validation loss (0 never stops).
+     * @param restore_best Load the weights of the best validated epoch when training ends.
+     * @param num_threads Threads used by each validation run.
+     * @throws std::invalid_argument if the model has a memory-mapped Embedding table (see
+     * Embedding::clone); validate such models with evaluate() instead.
+     */
+    void set_validation(Iterator& validation_loader, Iterator& target_loader, size_t patience = 0,
+                        bool restore_best = true, size_t num_threads = 1) {
+        validator = std::make_shared<BackgroundValidator>(
+            model, loss_function, validation_loader, target_loader, patience, num_threads);
+        restore_best_weights = restore_best;
+    }
+
+    /**
+     * @brief Trains data-parallel with other processes: every rank trains a replica on its own
+     * shard of the data and gradients are averaged over all ranks at every optimizer step,
+     * overlapped with the backward pass. Collective: every rank calls it before training,
+     * and rank 0's parameters are broadcast to the others. All ranks must see the same number
+     * of rows per epoch (see DataFrameUtils::shard). Only rank 0 shows the terminal display;
+     * published losses are averaged over the ranks.
+     * @param communicator The ranks of the job, e.g. a TcpCommunicator or SharedMemoryCommunicator.
+     * @param bucket_size Minimum number of gradients per all-reduce.
+     * @throws std::invalid_argument if the model has parameters outside its store (Embedding).
+     */
+    void set_distributed(std::shared_ptr<Communicator> communicator, size_t bucket_size = 16384) {
+        auto attached = std::make_shared<GradientSynchronizer>(std::move(communicator), bucket_size);
+        attached->attach(model);
+        synchronizer = std::move(attached);
+        if (synchronizer->get_communicator().get_rank() != 0) {
+            set_terminal_display(false);
+        }
+    }
+
+    /**
+     * @brief Enables dynamic loss scaling, for models with low-precision layers.
+     * @param initial_scale Starting scale factor.
+     * @param growth_interval Clean steps before the scale doubles.
+     */
+    void set_loss_scaling(long double initial_scale = 65536.0L, size_t growth_interval = 2000) {
+        loss_scaler = std::make_shared<LossScaler>(initial_scale, growth_interval);
+    }
+
+    /**
+     * @brief Returns the loss scaler configured by set_loss_scaling, or nullptr.
+     */
+    std::shared_ptr<const LossScaler> get_loss_scaler() const {
+        return loss_scaler;
+    }
+
+    /**
+     * @brief Returns the publisher of the per-epoch and per-step training losses.
+     * Subscribe through its event manager to LossPublisher::LOSS_UPDATED or BATCH_LOSS.
+     */
+    LossPublisher& get_loss_publisher() {
+        return loss_publisher;
+    }
+
+    /**
+     * @brief Returns the validator configured by set_validation, or nullptr.
+     */
+    std::shared_ptr<const BackgroundValidator> get_validator() const {
+        return validator;
+    }
+
+    /**
+     * @brief Train the model with plain gradient descent.
+     * @param train_loader Training data loader.
+     * @param target_loader Target data loader.
+     * @param learning_rate Learning rate for training.
+     * @param accumulation_steps Number of samples whose gradients are averaged per update.
+     */
+    void train(Iterator& train_loader, Iterator& target_loader, long double learning_rate,
+               size_t accumulation_steps = 1) {
+        SGD optimizer(learning_rate);
+        train(train_loader, target_loader, optimizer, accumulation_steps);
+    }
+
+    /**
+     * @brief Train the model with the given data and optimizer.
+     * @param train_loader Training data loader.
+     * @param target_loader Target data loader.
+     * @param optimizer Optimizer stepping over the model's flat parameter buffer.
+     * @param accumulation_steps Number of samples whose gradients are accumulated and averaged
+     * before the optimizer steps. The step also resets the gradients, so both happen once per
+     * accumulation window. A partial window at the end of an epoch is applied with its own average.
+     * @throws std::invalid_argument if accumulation_steps is zero.
+     */
+    void train(Iterator& train_loader, Iterator& target_loader, Optimizer& optimizer,
+               size_t accumulation_steps = 1) {
+        run_training(train_loader, target_loader, optimizer, accumulation_steps);
+    }
+
+    /**
+     * @brief Train the model on sparse inputs with plain gradient descent.
+     * The first module must accept sparse inputs (e.g. a LinearLayer).
+     * @param train_loader Sparse training data loader.
+     * @param target_loader Target data loader.
+     * @param learning_rate Learning rate for training.
+     * @param accumulation_steps Number of samples whose gradients are averaged per update.
+     */
+    void train(SparseIterator& train_loader, Iterator& target_loader, long double learning_rate,
+               size_t accumulation_steps = 1) {
+        SGD optimizer(learning_rate);
+        train(train_loader, target_loader, optimizer, accumulation_steps);
+    }
+
+    /**
+     * @brief Train the model on sparse inputs with the given optimizer.
+     * The first module must accept sparse inputs (e.g. a LinearLayer).
+     * @param train_loader Sparse training data loader.
+     * @param target_loader Target data loader.
+     * @param optimizer Optimizer stepping over the model's flat parameter buffer.
+     * @param accumulation_steps Number of samples whose gradients are averaged per update.
+     */
+    void train(SparseIterator& train_loader, Iterator& target_loader, Optimizer& optimizer,
+               size_t accumulation_steps = 1) {
+        run_training(train_loader, target_loader, optimizer, accumulation_steps);
+    }
+
+    /**
+     * @brief Evaluate the model in parallel and return every collected metric.
      * @param test_loader Testing data loader.
      * @param target_loader Testing target loader.
+     * @param num_threads Number of worker threads (0 uses every hardware thread).
+     * @param auc_bins Histogram bins for an approximate ROC-AUC (0 computes it exactly).
+     * @return Loss, accuracy, confusion matrix, precision, recall and ROC-AUC.
      */
-    void test(Iterator& test_loader, Iterator& target_loader) {
-        long double totalLoss = 0.0;
-        long double totalAccuracy = 0.0;
-        size_t totalSamples = 0;
+    EvaluationResults evaluate(Iterator& test_loader, Iterator& target_loader,
+                               size_t num_threads = 0, size_t auc_bins = 0) const {
+        Evaluator evaluator(loss_function, num_threads, auc_bins);
+        return evaluator.evaluate(model, test_loader, target_loader);
+    }
 
-        test_loader.reset();
-        target_loader.reset();
+    /**
+     * @brief Evaluate the model in parallel on sparse inputs and return every collected metric.
+     * The first module must accept sparse inputs (e.g. a LinearLayer).
+     * @param test_loader Sparse testing data loader.
+     * @param target_loader Testing target loader.
+     * @param num_threads Number of worker threads (0 uses every hardware thread).
+     * @param auc_bins Histogram bins for an approximate ROC-AUC (0 computes it exactly).
+     * @return Loss, accuracy, confusion matrix, precision, recall and ROC-AUC.
+     */
+    EvaluationResults evaluate(SparseIterator& test_loader, Iterator& target_loader,
+                               size_t num_threads = 0, size_t auc_bins = 0) const {
+        Evaluator evaluator(loss_function, num_threads, auc_bins);
+        return evaluator.evaluate(model, test_loader, target_loader);
+    }
 
-        while (test_loader.has_more() && target_loader.has_more()) {
-            const auto& input = test_loader.get_next();
-            const auto& target = target_loader.get_next();
+    /**
+     * @brief Test the model and compute accuracy.
+     * @param test_loader Testing data loader.
+     * @param target_loader Testing target loader.
+     * @return The average loss and the accuracy percentage.
+     */
+    TestResults test(Iterator& test_loader, Iterator& target_loader) {
+        EvaluationResults results = evaluate(test_loader, target_loader);
 
-            auto prediction = model.forward(input);
+        std::cout << "Test Loss: " << results.loss << "\n";
+        std::cout << "Test Accuracy: " << results.accuracy << "%\n";
 
-            totalLoss += loss_function->compute_loss({prediction[0]}, {target[0]});
-            totalAccuracy += calculate_accuracy(prediction[0], target[0]);
+        return {results.loss, results.accuracy};
+    }
 
-            ++totalSamples;
-        }
+    /**
+     * @brief Test the model on sparse inputs and compute accuracy.
+     * @param test_loader Sparse testing data loader.
+     * @param target_loader Testing target loader.
+     * @return The average loss and the accuracy percentage.
+     */
+    TestResults test(SparseIterator& test_loader, Iterator& target_loader) {
+        EvaluationResults results = evaluate(test_loader, target_loader);
 
-        long double averageLoss = totalLoss / totalSamples;
-        long double accuracyPercentage = (totalAccuracy / totalSamples) * 100.0L;
+        std::cout << "Test Loss: " << results.loss << "\n";
+        std::cout << "Test Accuracy: " << results.accuracy << "%\n";
 
-        std::cout << "Test Loss: " << averageLoss << "\n";
-        std::cout << "Test Accuracy: " << accuracyPercentage << "%\n";
+        return {results.loss, results.accuracy};
     }
 };
 
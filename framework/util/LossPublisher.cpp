@@ -1,8 +1,27 @@
 #include "LossPublisher.h"
 
+const EventId LossPublisher::LOSS_UPDATED = EventManager::intern("loss_updated");
+const EventId LossPublisher::BATCH_LOSS = EventManager::intern("batch_loss");
+const EventId LossPublisher::SAMPLES = EventManager::intern("samples");
+const EventId LossPublisher::STEP_SECONDS = EventManager::intern("step_seconds");
+const EventId LossPublisher::FETCH_SECONDS = EventManager::intern("fetch_seconds");
+
 void LossPublisher::publish_loss(double loss, size_t epoch) {
     epoch_losses.emplace_back(loss, epoch);
-    event_manager.notify("loss_updated", loss, epoch);
+    event_manager.publish(Event(LOSS_UPDATED, loss, epoch));
+}
+
+void LossPublisher::publish_batch_loss(double loss, size_t epoch, size_t step, size_t samples,
+                                       double step_seconds, double fetch_seconds) {
+    Event event(BATCH_LOSS, loss, epoch, step);
+    event.add_metric(SAMPLES, static_cast<double>(samples))
+         .add_metric(STEP_SECONDS, step_seconds)
+         .add_metric(FETCH_SECONDS, fetch_seconds);
+    event_manager.publish(event);
+}
+
+void LossPublisher::flush() {
+    event_manager.flush();
 }
 
 const std::vector<std::pair<double, size_t>>& LossPublisher::get_losses() const {
@@ -11,4 +30,4 @@ const std::vector<std::pair<double, size_t>>& LossPublisher::get_losses() const
 
 EventManager& LossPublisher::get_event_manager() {
     return event_manager;
-}
\ No newline at end of file
+}
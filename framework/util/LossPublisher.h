@@ -14,6 +14,24 @@ private:
     std::vector<std::pair<double, size_t>> epoch_losses;
 
 public:
+    /**
+     * @brief Event published once per epoch with the average training loss.
+     */
+    static const EventId LOSS_UPDATED;
+
+    /**
+     * @brief Event published once per optimizer step with the loss of that step's samples.
+     */
+    static const EventId BATCH_LOSS;
+
+    /**
+     * @brief Metrics attached to BATCH_LOSS: samples in the step, wall time of the step in
+     * seconds and the part of it spent waiting for the data loaders.
+     */
+    static const EventId SAMPLES;
+    static const EventId STEP_SECONDS;
+    static const EventId FETCH_SECONDS;
+
     /**
      * @brief Adds a new loss value and notifies subscribers.
      * @param loss The loss value to add.
@@ -21,6 +39,23 @@ public:
      */
     void publish_loss(double loss, size_t epoch);
 
+    /**
+     * @brief Notifies subscribers of the loss of one optimizer step; not recorded.
+     * @param loss The average loss of the step's samples.
+     * @param epoch The current epoch.
+     * @param step The step within the epoch, starting at 1.
+     * @param samples Number of samples in the step.
+     * @param step_seconds Wall time of the step.
+     * @param fetch_seconds Time of the step spent fetching rows from the loaders.
+     */
+    void publish_batch_loss(double loss, size_t epoch, size_t step, size_t samples = 1,
+                            double step_seconds = 0.0, double fetch_seconds = 0.0);
+
+    /**
+     * @brief Waits until subscribers have received everything published so far.
+     */
+    void flush();
+
     /**
      * @brief Gets all the recorded loss values.
      * @return A const reference to the vector of loss values and epochs.
@@ -0,0 +1,147 @@
+#include "MagnitudePruner.h"
+#include "BlockSparseLinearLayer.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+    void check_sparsity(long double sparsity) {
+        if (sparsity < 0.0L || sparsity > 1.0L) {
+            throw std::invalid_argument("Sparsity must be between 0 and 1.");
+        }
+    }
+
+    Sequential copy_of(const Sequential& model) {
+        return *std::static_pointer_cast<Sequential>(model.clone());
+    }
+
+    size_t weight_bytes(const Sequential& model) {
+        size_t bytes = 0;
+        for (const auto& module : model.get_modules()) {
+            if (auto linear = std::dynamic_pointer_cast<LinearLayer>(module)) {
+                bytes += (linear->get_input_size() + 1) * linear->get_output_size() * sizeof(long double);
+            } else if (auto sparse = std::dynamic_pointer_cast<BlockSparseLinearLayer>(module)) {
+                bytes += sparse->weight_bytes();
+            }
+        }
+        return bytes;
+    }
+
+    long double zero_fraction(const Sequential& model) {
+        size_t zeros = 0;
+        size_t total = 0;
+        for (const auto& module : model.get_modules()) {
+            if (auto linear = std::dynamic_pointer_cast<LinearLayer>(module)) {
+                ParameterView weights = linear->get_weights();
+                zeros += std::count(weights.begin(), weights.end(), 0.0L);
+                total += weights.size;
+            }
+        }
+        return total == 0 ? 0.0L : static_cast<long double>(zeros) / total;
+    }
+}
+
+MagnitudePruner::MagnitudePruner(size_t block_rows, size_t block_cols)
+    : block_rows(block_rows), block_cols(block_cols) {
+    if (block_rows == 0 || block_cols == 0) {
+        throw std::invalid_argument("Block dimensions must be positive.");
+    }
+}
+
+void MagnitudePruner::prune_layer(LinearLayer& layer, long double sparsity) const {
+    size_t inputs = layer.get_input_size();
+    size_t outputs = layer.get_output_size();
+    size_t row_blocks = (outputs + block_rows - 1) / block_rows;
+    size_t col_blocks = (inputs + block_cols - 1) / block_cols;
+    size_t blocks = row_blocks * col_blocks;
+    size_t to_prune = static_cast<size_t>(std::llround(sparsity * blocks));
+    if (to_prune == 0) {
+        return;
+    }
+
+    ParameterView weights = layer.get_weights();
+    auto for_each_weight = [&](size_t block, auto&& visit) {
+        size_t br = block / col_blocks;
+        size_t bc = block % col_blocks;
+        for (size_t i = br * block_rows; i < std::min(outputs, (br + 1) * block_rows); ++i) {
+            for (size_t j = bc * block_cols; j < std::min(inputs, (bc + 1) * block_cols); ++j) {
+                visit(weights[i * inputs + j]);
+            }
+        }
+    };
+
+    std::vector<long double> norms(blocks, 0.0L);
+    for (size_t b = 0; b < blocks; ++b) {
+        for_each_weight(b, [&](long double& w) { norms[b] += w * w; });
+    }
+
+    std::vector<size_t> order(blocks);
+    std::iota(order.begin(), order.end(), 0);
+    std::nth_element(order.begin(), order.begin() + (to_prune - 1), order.end(),
+                     [&](size_t a, size_t b) { return norms[a] < norms[b]; });
+
+    for (size_t k = 0; k < to_prune; ++k) {
+        for_each_weight(order[k], [](long double& w) { w = 0.0L; });
+    }
+}
+
+Sequential MagnitudePruner::prune(const Sequential& model, long double sparsity) const {
+    check_sparsity(sparsity);
+
+    Sequential pruned = copy_of(model);
+    for (const auto& module : pruned.get_modules()) {
+        if (auto linear = std::dynamic_pointer_cast<LinearLayer>(module)) {
+            prune_layer(*linear, sparsity);
+        }
+    }
+    return pruned;
+}
+
+Sequential MagnitudePruner::prune_iteratively(const Sequential& model, std::shared_ptr<LossFunction> loss_function,
+                                              Iterator& train_loader, Iterator& target_loader, long double sparsity,
+                                              size_t rounds, size_t epochs_per_round, long double learning_rate) const {
+    check_sparsity(sparsity);
+    if (rounds == 0) {
+        throw std::invalid_argument("rounds must be at least 1.");
+    }
+
+    Sequential pruned = copy_of(model);
+    for (size_t round = 1; round <= rounds; ++round) {
+        pruned = prune(pruned, sparsity * round / rounds);
+        if (epochs_per_round > 0) {
+            LearningFacade facade(pruned, loss_function, epochs_per_round);
+            facade.train(train_loader, target_loader, learning_rate);
+        }
+    }
+    return prune(pruned, sparsity);
+}
+
+Sequential MagnitudePruner::compress(const Sequential& model) const {
+    Sequential compressed;
+    for (const auto& module : model.get_modules()) {
+        if (auto linear = std::dynamic_pointer_cast<LinearLayer>(module)) {
+            compressed.add_module(std::make_shared<BlockSparseLinearLayer>(*linear, block_rows, block_cols));
+        } else {
+            compressed.add_module(module->clone());
+        }
+    }
+    return compressed;
+}
+
+PruningReport MagnitudePruner::evaluate(const Sequential& dense_model, const Sequential& pruned_model,
+                                        std::shared_ptr<LossFunction> loss_function,
+                                        Iterator& test_loader, Iterator& target_loader) const {
+    Sequential compressed = compress(pruned_model);
+    LearningFacade dense_facade(dense_model, loss_function, 0);
+    LearningFacade pruned_facade(compressed, loss_function, 0);
+
+    PruningReport report{};
+    report.dense_results = dense_facade.test(test_loader, target_loader);
+    report.pruned_results = pruned_facade.test(test_loader, target_loader);
+    report.accuracy_delta = report.pruned_results.accuracy - report.dense_results.accuracy;
+    report.sparsity = zero_fraction(pruned_model);
+    report.dense_weight_bytes = weight_bytes(dense_model);
+    report.sparse_weight_bytes = weight_bytes(compressed);
+    return report;
+}
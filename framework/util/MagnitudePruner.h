@@ -0,0 +1,102 @@
+#ifndef MAGNITUDEPRUNER_H
+#define MAGNITUDEPRUNER_H
+
+#include "SequentialNN.h"
+#include "LinearLayer.h"
+#include "LossFunction.h"
+#include "LearningFacade.h"
+#include <memory>
+#include <cstddef>
+
+/**
+ * @struct PruningReport
+ * @brief Compares a dense model against its pruned, block-sparse counterpart.
+ */
+struct PruningReport {
+    TestResults dense_results;
+    TestResults pruned_results;
+    long double accuracy_delta;     ///< Pruned minus dense accuracy, in percentage points.
+    long double sparsity;           ///< Fraction of LinearLayer weights that are zero after pruning.
+    size_t dense_weight_bytes;
+    size_t sparse_weight_bytes;
+};
+
+/**
+ * @class MagnitudePruner
+ * @brief Zeroes the smallest weight blocks of every LinearLayer and compresses the result.
+ *
+ * Weights are ranked per layer by the L2 norm of block_rows x block_cols blocks, the same
+ * tiling BlockSparseLinearLayer stores, so every pruned block is skipped at inference time.
+ */
+class MagnitudePruner {
+private:
+    size_t block_rows;
+    size_t block_cols;
+
+    /**
+     * @brief Zeroes the lowest-norm blocks of one layer.
+     * @param layer The layer to prune in place.
+     * @param sparsity Fraction of blocks to zero.
+     */
+    void prune_layer(LinearLayer& layer, long double sparsity) const;
+
+public:
+    /**
+     * @brief Constructor for MagnitudePruner.
+     * @param block_rows Rows per pruning block (1 with block_cols 1 prunes single weights).
+     * @param block_cols Columns per pruning block.
+     * @throws std::invalid_argument if a block dimension is zero.
+     */
+    explicit MagnitudePruner(size_t block_rows = 4, size_t block_cols = 4);
+
+    /**
+     * @brief Prunes a copy of a trained model in one shot.
+     * @param model The trained model; it is not modified.
+     * @param sparsity Fraction of blocks to remove from every LinearLayer, in [0, 1].
+     * @return The pruned copy, still made of trainable LinearLayers.
+     * @throws std::invalid_argument if sparsity is outside [0, 1].
+     */
+    Sequential prune(const Sequential& model, long double sparsity) const;
+
+    /**
+     * @brief Prunes a copy of a trained model gradually, fine-tuning between rounds.
+     * Round r prunes to sparsity * r / rounds and then trains for epochs_per_round through
+     * LearningFacade::train; the result is pruned once more so fine-tuning cannot revive
+     * removed blocks.
+     * @param model The trained model; it is not modified.
+     * @param loss_function The loss function used for fine-tuning.
+     * @param train_loader Training data loader.
+     * @param target_loader Training target loader.
+     * @param sparsity Final fraction of blocks to remove, in [0, 1].
+     * @param rounds Number of prune/fine-tune rounds.
+     * @param epochs_per_round Fine-tuning epochs after each round.
+     * @param learning_rate Learning rate for fine-tuning.
+     * @return The pruned copy.
+     * @throws std::invalid_argument if sparsity is outside [0, 1] or rounds is zero.
+     */
+    Sequential prune_iteratively(const Sequential& model, std::shared_ptr<LossFunction> loss_function,
+                                 Iterator& train_loader, Iterator& target_loader, long double sparsity,
+                                 size_t rounds, size_t epochs_per_round, long double learning_rate) const;
+
+    /**
+     * @brief Replaces every LinearLayer with a BlockSparseLinearLayer using the pruning blocks.
+     * @param model A pruned model.
+     * @return A new, inference-only Sequential holding clones of the other modules.
+     */
+    Sequential compress(const Sequential& model) const;
+
+    /**
+     * @brief Tests the dense model and the compressed pruned model and reports the difference.
+     * @param dense_model The model before pruning.
+     * @param pruned_model The model returned by prune() or prune_iteratively().
+     * @param loss_function The loss function used for testing.
+     * @param test_loader Testing data loader.
+     * @param target_loader Testing target loader.
+     * @return Accuracy, loss, sparsity and weight memory of both models.
+     */
+    PruningReport evaluate(const Sequential& dense_model, const Sequential& pruned_model,
+                           std::shared_ptr<LossFunction> loss_function,
+                           Iterator& test_loader, Iterator& target_loader) const;
+};
+
+#endif // MAGNITUDEPRUNER_H
@@ -0,0 +1,172 @@
+#include "ModelCodeGenerator.h"
+#include "LinearLayer.h"
+#include "ActivationLayer.h"
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    const char* scalar_name(GeneratedPrecision precision) {
+        switch (precision) {
+            case GeneratedPrecision::Float: return "float";
+            case GeneratedPrecision::LongDouble: return "long double";
+            default: return "double";
+        }
+    }
+
+    // Prints a literal that round-trips exactly in the target type.
+    void write_literal(std::ostream& out, long double value, GeneratedPrecision precision) {
+        // inf and nan have no literal, and finite values may still overflow a narrower type.
+        bool finite = precision == GeneratedPrecision::Float ? std::isfinite(static_cast<float>(value))
+                    : precision == GeneratedPrecision::Double ? std::isfinite(static_cast<double>(value))
+                    : std::isfinite(value);
+        if (!finite) {
+            throw std::invalid_argument("Cannot export non-finite weights (or weights out of the range of the generated type).");
+        }
+        out << std::showpoint;
+        switch (precision) {
+            case GeneratedPrecision::Float:
+                out << std::setprecision(std::numeric_limits<float>::max_digits10)
+                    << static_cast<float>(value) << "f";
+                break;
+            case GeneratedPrecision::LongDouble:
+                out << std::setprecision(std::numeric_limits<long double>::max_digits10) << value << "L";
+                break;
+            default:
+                out << std::setprecision(std::numeric_limits<double>::max_digits10) << static_cast<double>(value);
+                break;
+        }
+    }
+
+    void write_array(std::ostream& out, const std::string& name, const std::vector<long double>& values,
+                     GeneratedPrecision precision) {
+        out << "alignas(64) constexpr Scalar " << name << "[" << values.size() << "] = {";
+        for (size_t i = 0; i < values.size(); ++i) {
+            out << (i % 6 == 0 ? "\n    " : " ");
+            write_literal(out, values[i], precision);
+            out << ",";
+        }
+        out << "\n};\n\n";
+    }
+
+    const char* activation_expression(ActivationKind kind) {
+        switch (kind) {
+            case ActivationKind::Identity:
+                return nullptr;
+            case ActivationKind::ReLU:
+                return "x > Scalar(0) ? x : Scalar(0)";
+            case ActivationKind::Sigmoid:
+                return "Scalar(1) / (Scalar(1) + std::exp(-x))";
+            case ActivationKind::Tanh:
+                return "std::tanh(x)";
+            default:
+                throw std::invalid_argument("Custom activations cannot be exported.");
+        }
+    }
+}
+
+ModelCodeGenerator::ModelCodeGenerator(std::string namespace_name, GeneratedPrecision precision)
+    : namespace_name(std::move(namespace_name)), precision(precision) {}
+
+std::string ModelCodeGenerator::generate(const Sequential& model) const {
+    const auto& modules = model.get_modules();
+    if (modules.empty()) {
+        throw std::invalid_argument("Cannot export an empty model.");
+    }
+
+    std::ostringstream constants;
+    std::ostringstream body;
+    size_t input_size = 0;
+    size_t current_size = 0;
+    size_t layer = 0;
+    std::string current = "input";
+
+    for (const auto& module : modules) {
+        if (const auto* linear = dynamic_cast<const LinearLayer*>(module.get())) {
+            size_t in = linear->get_input_size();
+            size_t out = linear->get_output_size();
+            if (current_size == 0) {
+                input_size = in;
+            } else if (in != current_size) {
+                throw std::invalid_argument("Layer sizes of the model do not chain.");
+            }
+
+            // input-major layout: weights_t[j * out + i] = W[i][j]
+            ParameterView weights = linear->get_weights();
+            std::vector<long double> transposed(in * out);
+            for (size_t i = 0; i < out; ++i) {
+                for (size_t j = 0; j < in; ++j) {
+                    transposed[j * out + i] = weights[i * in + j];
+                }
+            }
+            ParameterView biases = linear->get_biases();
+            std::string weights_name = "layer" + std::to_string(layer) + "_weights";
+            std::string biases_name = "layer" + std::to_string(layer) + "_biases";
+            write_array(constants, weights_name, transposed, precision);
+            write_array(constants, biases_name, std::vector<long double>(biases.begin(), biases.end()), precision);
+
+            std::string next = "h" + std::to_string(layer);
+            body << "    alignas(64) Scalar " << next << "[" << out << "];\n"
+                 << "    for (std::size_t i = 0; i < " << out << "; ++i) " << next << "[i] = " << biases_name << "[i];\n"
+                 << "    for (std::size_t j = 0; j < " << in << "; ++j) {\n"
+                 << "        const Scalar x = " << current << "[j];\n"
+                 << "        const Scalar* w = " << weights_name << " + j * " << out << ";\n"
+                 << "        for (std::size_t i = 0; i < " << out << "; ++i) " << next << "[i] += w[i] * x;\n"
+                 << "    }\n";
+
+            current = next;
+            current_size = out;
+            ++layer;
+        } else if (const auto* activation = dynamic_cast<const ActivationLayer*>(module.get())) {
+            if (current_size == 0) {
+                throw std::invalid_argument("The model must start with a LinearLayer.");
+            }
+            const char* expression = activation_expression(activation->kind());
+            if (expression) {
+                body << "    for (std::size_t i = 0; i < " << current_size << "; ++i) {\n"
+                     << "        const Scalar x = " << current << "[i];\n"
+                     << "        " << current << "[i] = " << expression << ";\n"
+                     << "    }\n";
+            }
+        } else {
+            throw std::invalid_argument("Only LinearLayer and ActivationLayer modules can be exported.");
+        }
+    }
+
+    if (current_size == 0) {
+        throw std::invalid_argument("The model must contain a LinearLayer.");
+    }
+
+    std::ostringstream source;
+    source << "// Generated by ModelCodeGenerator. Do not edit.\n"
+           << "#pragma once\n\n"
+           << "#include <cmath>\n"
+           << "#include <cstddef>\n\n"
+           << "namespace " << namespace_name << " {\n\n"
+           << "using Scalar = " << scalar_name(precision) << ";\n\n"
+           << "constexpr std::size_t input_size = " << input_size << ";\n"
+           << "constexpr std::size_t output_size = " << current_size << ";\n\n"
+           << constants.str()
+           << "inline void predict(const Scalar* input, Scalar* output) {\n"
+           << body.str()
+           << "    for (std::size_t i = 0; i < output_size; ++i) output[i] = " << current << "[i];\n"
+           << "}\n\n"
+           << "} // namespace " << namespace_name << "\n";
+    return source.str();
+}
+
+void ModelCodeGenerator::write(const Sequential& model, const std::string& path) const {
+    std::string source = generate(model);
+
+    std::ofstream file(path);
+    if (!file) {
+        throw std::runtime_error("Unable to open output file: " + path);
+    }
+    file << source;
+    if (!file) {
+        throw std::runtime_error("Unable to write output file: " + path);
+    }
+}
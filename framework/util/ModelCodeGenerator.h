@@ -0,0 +1,60 @@
+#ifndef MODELCODEGENERATOR_H
+#define MODELCODEGENERATOR_H
+
+#include "SequentialNN.h"
+#include <string>
+
+/**
+ * @enum GeneratedPrecision
+ * @brief Scalar type used by generated code.
+ */
+enum class GeneratedPrecision {
+    Float,
+    Double,
+    LongDouble     ///< Same type as the framework; reproduces Sequential::predict bit for bit.
+};
+
+/**
+ * @class ModelCodeGenerator
+ * @brief Emits a trained model as a self-contained C++ source file.
+ *
+ * The generated file depends only on <cmath> and <cstddef>. Weights are baked in as aligned
+ * constexpr arrays, stored input-major so that each layer is a sequence of independent
+ * multiply-adds over the outputs, which compilers vectorize without reassociating sums.
+ * Outputs are accumulated in the same order as LinearLayer::predict.
+ */
+class ModelCodeGenerator {
+private:
+    std::string namespace_name;
+    GeneratedPrecision precision;
+
+public:
+    /**
+     * @brief Constructor for ModelCodeGenerator.
+     * @param namespace_name Namespace wrapping the generated constants and predict().
+     * @param precision Scalar type of the generated code.
+     */
+    explicit ModelCodeGenerator(std::string namespace_name = "model",
+                                GeneratedPrecision precision = GeneratedPrecision::Double);
+
+    /**
+     * @brief Generates the source code for a model.
+     * @param model A Sequential of LinearLayers and built-in ActivationLayers.
+     * @return The source of a header-style file defining input_size, output_size and
+     *         predict(const Scalar* input, Scalar* output).
+     * @throws std::invalid_argument if the model contains other modules or custom activations,
+     * or a weight is not finite in the generated type.
+     */
+    std::string generate(const Sequential& model) const;
+
+    /**
+     * @brief Generates the source code for a model and writes it to a file.
+     * @param model The model to export.
+     * @param path Destination file.
+     * @throws std::invalid_argument if the model cannot be exported (see generate).
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    void write(const Sequential& model, const std::string& path) const;
+};
+
+#endif // MODELCODEGENERATOR_H
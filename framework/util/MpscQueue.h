@@ -0,0 +1,113 @@
+#ifndef MPSCQUEUE_H
+#define MPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @class MpscQueue
+ * @brief Bounded lock-free queue for many producers and a single consumer.
+ *
+ * A ring of slots, each tagged with a sequence number (Vyukov's bounded queue). Producers
+ * claim a slot with one compare-and-swap on the tail and never wait: when the ring is full
+ * try_push fails instead of blocking. Only one thread may call try_pop.
+ */
+template <typename T>
+class MpscQueue {
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+    alignas(64) std::atomic<size_t> tail{0};
+    alignas(64) size_t head = 0;
+
+public:
+    /**
+     * @brief Constructor for MpscQueue.
+     * @param capacity Number of slots, rounded up to a power of two.
+     * @throws std::invalid_argument if capacity is zero.
+     */
+    explicit MpscQueue(size_t capacity) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Queue capacity must be at least 1.");
+        }
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        slots.reset(new Slot[size]);
+        mask = size - 1;
+        for (size_t i = 0; i < size; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /**
+     * @brief Appends a value; safe to call from any number of threads.
+     * @param value The value to copy into the queue.
+     * @return False if the queue is full.
+     */
+    bool try_push(const T& value) {
+        size_t position = tail.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots[position & mask];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+            if (diff == 0) {
+                if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot.value = value;
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Removes the oldest value; only the consumer thread may call this.
+     * @param value Receives the value.
+     * @return False if the queue is empty (or the oldest slot is still being written).
+     */
+    bool try_pop(T& value) {
+        Slot& slot = slots[head & mask];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != head + 1) {
+            return false;
+        }
+        value = std::move(slot.value);
+        slot.sequence.store(head + mask + 1, std::memory_order_release);
+        ++head;
+        return true;
+    }
+
+    /**
+     * @brief Returns how many values producers have claimed slots for so far.
+     */
+    size_t claimed() const {
+        return tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Returns how many values the consumer has popped; consumer thread only.
+     */
+    size_t popped() const {
+        return head;
+    }
+};
+
+#endif // MPSCQUEUE_H
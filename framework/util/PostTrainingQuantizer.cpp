@@ -0,0 +1,88 @@
+#include "PostTrainingQuantizer.h"
+#include "LinearLayer.h"
+#include "ActivationLayer.h"
+#include "QuantizedLinearLayer.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    size_t weight_bytes(const Sequential& model) {
+        size_t bytes = 0;
+        for (const auto& module : model.get_modules()) {
+            if (auto linear = std::dynamic_pointer_cast<LinearLayer>(module)) {
+                bytes += (linear->get_input_size() + 1) * linear->get_output_size() * sizeof(long double);
+            } else if (auto quantized = std::dynamic_pointer_cast<QuantizedLinearLayer>(module)) {
+                bytes += quantized->weight_bytes();
+            }
+        }
+        return bytes;
+    }
+}
+
+PostTrainingQuantizer::PostTrainingQuantizer(const DataFrame& calibration_data)
+    : calibration_data(calibration_data) {}
+
+std::vector<long double> PostTrainingQuantizer::calibrate(const Sequential& model) const {
+    const auto& modules = model.get_modules();
+    std::vector<long double> ranges(modules.size(), 0.0L);
+
+    for (const auto& row : calibration_data.get_data()) {
+        std::vector<long double> activations = row;
+        for (size_t m = 0; m < modules.size(); ++m) {
+            for (long double value : activations) {
+                ranges[m] = std::max(ranges[m], std::fabs(value));
+            }
+            activations = modules[m]->predict(activations);
+        }
+    }
+
+    return ranges;
+}
+
+Sequential PostTrainingQuantizer::quantize(const Sequential& model) const {
+    if (calibration_data.row_count() == 0) {
+        throw std::invalid_argument("Calibration data must contain at least one row.");
+    }
+
+    const auto& modules = model.get_modules();
+    auto ranges = calibrate(model);
+
+    Sequential quantized;
+    for (size_t m = 0; m < modules.size(); ++m) {
+        auto linear = std::dynamic_pointer_cast<LinearLayer>(modules[m]);
+        if (!linear) {
+            quantized.add_module(modules[m]->clone());
+            continue;
+        }
+
+        long double input_range = ranges[m];
+        ActivationKind activation = ActivationKind::Identity;
+        if (m + 1 < modules.size()) {
+            auto next = std::dynamic_pointer_cast<ActivationLayer>(modules[m + 1]);
+            if (next && next->kind() != ActivationKind::Custom) {
+                activation = next->kind();
+                ++m; // the activation is fused into the quantized layer
+            }
+        }
+
+        quantized.add_module(std::make_shared<QuantizedLinearLayer>(*linear, input_range, activation));
+    }
+
+    return quantized;
+}
+
+QuantizationReport PostTrainingQuantizer::evaluate(const Sequential& float_model, const Sequential& quantized_model,
+                                                   std::shared_ptr<LossFunction> loss_function,
+                                                   Iterator& test_loader, Iterator& target_loader) const {
+    LearningFacade float_facade(float_model, loss_function, 0);
+    LearningFacade quantized_facade(quantized_model, loss_function, 0);
+
+    QuantizationReport report{};
+    report.float_results = float_facade.test(test_loader, target_loader);
+    report.quantized_results = quantized_facade.test(test_loader, target_loader);
+    report.accuracy_delta = report.quantized_results.accuracy - report.float_results.accuracy;
+    report.float_weight_bytes = weight_bytes(float_model);
+    report.quantized_weight_bytes = weight_bytes(quantized_model);
+    return report;
+}
@@ -0,0 +1,70 @@
+#ifndef POSTTRAININGQUANTIZER_H
+#define POSTTRAININGQUANTIZER_H
+
+#include "SequentialNN.h"
+#include "DataFrame.h"
+#include "LossFunction.h"
+#include "LearningFacade.h"
+#include <memory>
+#include <cstddef>
+
+/**
+ * @struct QuantizationReport
+ * @brief Compares a float model against its int8 quantized counterpart.
+ */
+struct QuantizationReport {
+    TestResults float_results;
+    TestResults quantized_results;
+    long double accuracy_delta;     ///< Quantized minus float accuracy, in percentage points.
+    size_t float_weight_bytes;
+    size_t quantized_weight_bytes;
+};
+
+/**
+ * @class PostTrainingQuantizer
+ * @brief Converts the LinearLayers of a trained model into int8 QuantizedLinearLayers.
+ *
+ * Input ranges are calibrated by running a sample DataFrame through the float model.
+ * A LinearLayer followed by a built-in ActivationLayer is fused into a single quantized layer.
+ */
+class PostTrainingQuantizer {
+private:
+    const DataFrame& calibration_data;
+
+    /**
+     * @brief Records the largest absolute input seen by every module.
+     * @param model The float model to calibrate.
+     * @return One range per module of the model.
+     */
+    std::vector<long double> calibrate(const Sequential& model) const;
+
+public:
+    /**
+     * @brief Constructor for PostTrainingQuantizer.
+     * @param calibration_data Representative input rows (without the target column).
+     */
+    explicit PostTrainingQuantizer(const DataFrame& calibration_data);
+
+    /**
+     * @brief Builds the quantized version of a trained model.
+     * @param model The trained float model.
+     * @return A new Sequential holding clones of the non-linear modules of the float model.
+     * @throws std::invalid_argument if the calibration data is empty.
+     */
+    Sequential quantize(const Sequential& model) const;
+
+    /**
+     * @brief Tests both models through LearningFacade::test and reports the difference.
+     * @param float_model The trained float model.
+     * @param quantized_model The model returned by quantize().
+     * @param loss_function The loss function used for testing.
+     * @param test_loader Testing data loader.
+     * @param target_loader Testing target loader.
+     * @return Accuracy, loss and weight memory of both models.
+     */
+    QuantizationReport evaluate(const Sequential& float_model, const Sequential& quantized_model,
+                                std::shared_ptr<LossFunction> loss_function,
+                                Iterator& test_loader, Iterator& target_loader) const;
+};
+
+#endif // POSTTRAININGQUANTIZER_H
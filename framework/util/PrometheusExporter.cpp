@@ -0,0 +1,288 @@
+#include "PrometheusExporter.h"
+#include "LossPublisher.h"
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define DL_HAVE_MALLINFO2
+#endif
+
+namespace {
+    /**
+     * @brief Resident set size from /proc/self/statm, or -1 where unavailable.
+     */
+    long long resident_bytes() {
+        std::ifstream statm("/proc/self/statm");
+        long long total_pages = 0;
+        long long resident_pages = 0;
+        if (!(statm >> total_pages >> resident_pages)) {
+            return -1;
+        }
+        return resident_pages * sysconf(_SC_PAGESIZE);
+    }
+
+    void write_header(std::ostringstream& out, const char* name, const char* type, const char* help) {
+        out << "# HELP " << name << ' ' << help << '\n';
+        out << "# TYPE " << name << ' ' << type << '\n';
+    }
+
+    template <typename T>
+    void write_metric(std::ostringstream& out, const char* name, const char* type, const char* help, T value) {
+        write_header(out, name, type, help);
+        out << name << ' ' << value << '\n';
+    }
+}
+
+const std::array<double, PrometheusExporter::BUCKET_COUNT> PrometheusExporter::LATENCY_BUCKETS = {
+    0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1.0
+};
+
+PrometheusExporter::PrometheusExporter(const std::string& path, std::chrono::milliseconds write_interval)
+    : path(path), write_interval(write_interval) {}
+
+PrometheusExporter::~PrometheusExporter() {
+    detach();
+    stop_serving();
+    if (!path.empty()) {
+        try {
+            write_file();
+        } catch (const std::exception&) {
+            // Destructors must not throw.
+        }
+    }
+}
+
+void PrometheusExporter::attach(EventManager& event_manager) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (events) {
+            throw std::logic_error("PrometheusExporter is already attached to an event manager.");
+        }
+        events = &event_manager;
+    }
+    batch_subscription = event_manager.subscribe(LossPublisher::BATCH_LOSS, [this](const Event& event) {
+        record_step(event);
+    });
+    epoch_subscription = event_manager.subscribe(LossPublisher::LOSS_UPDATED, [this](const Event& event) {
+        record_epoch(event);
+    });
+}
+
+void PrometheusExporter::detach() {
+    EventManager* attached;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        attached = events;
+    }
+    if (!attached) {
+        return;
+    }
+    // Unsubscribing waits for a delivery in progress, so it must not hold our mutex.
+    attached->unsubscribe(batch_subscription);
+    attached->unsubscribe(epoch_subscription);
+    std::lock_guard<std::mutex> lock(mutex);
+    events = nullptr;
+}
+
+void PrometheusExporter::record_step(const Event& event) {
+    auto samples = static_cast<size_t>(event.get_metric(LossPublisher::SAMPLES, 1.0));
+    double step_seconds = event.get_metric(LossPublisher::STEP_SECONDS);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++steps_total;
+        samples_total += samples;
+        fetch_seconds_total += event.get_metric(LossPublisher::FETCH_SECONDS);
+        last_loss = event.value;
+        epoch = event.epoch;
+
+        size_t bucket = 0;
+        while (bucket < BUCKET_COUNT && step_seconds > LATENCY_BUCKETS[bucket]) {
+            ++bucket;
+        }
+        if (bucket < BUCKET_COUNT) {
+            ++latency_counts[bucket];
+        }
+        ++latency_count;
+        latency_sum += step_seconds;
+
+        // Throughput over windows of at least one second of training time.
+        if (steps_total == 1) {
+            rate_window_start = event.timestamp - std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(step_seconds));
+        }
+        rate_window_samples += samples;
+        std::chrono::duration<double> elapsed = event.timestamp - rate_window_start;
+        if (elapsed.count() >= 1.0) {
+            samples_per_second = rate_window_samples / elapsed.count();
+            rate_window_start = event.timestamp;
+            rate_window_samples = 0;
+        } else if (samples_total == rate_window_samples && elapsed.count() > 0.0) {
+            samples_per_second = rate_window_samples / elapsed.count();   // first window still open
+        }
+    }
+    maybe_write(std::chrono::steady_clock::now());
+}
+
+void PrometheusExporter::record_epoch(const Event& event) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        last_epoch_loss = event.value;
+        epoch = event.epoch;
+    }
+    maybe_write(std::chrono::steady_clock::now());
+}
+
+void PrometheusExporter::maybe_write(std::chrono::steady_clock::time_point now) {
+    if (path.empty() || now - last_write < write_interval) {
+        return;
+    }
+    last_write = now;
+    try {
+        write_file();
+    } catch (const std::exception&) {
+        // Listeners must not throw; the next interval retries.
+    }
+}
+
+std::string PrometheusExporter::render() const {
+    std::ostringstream out;
+    out << std::setprecision(10);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    write_metric(out, "dl_train_steps_total", "counter", "Optimizer steps taken.", steps_total);
+    write_metric(out, "dl_train_samples_total", "counter", "Training samples processed.", samples_total);
+    write_metric(out, "dl_train_samples_per_second", "gauge", "Training throughput over the last window.", samples_per_second);
+    write_metric(out, "dl_train_epoch", "gauge", "Current training epoch.", epoch);
+    write_metric(out, "dl_train_loss", "gauge", "Average loss of the latest optimizer step.", last_loss);
+    write_metric(out, "dl_train_epoch_loss", "gauge", "Average loss of the latest completed epoch.", last_epoch_loss);
+    write_metric(out, "dl_train_data_fetch_seconds_total", "counter",
+                 "Time the training loop spent waiting for the data loaders.", fetch_seconds_total);
+
+    write_header(out, "dl_train_step_duration_seconds", "histogram", "Wall time of one optimizer step.");
+    size_t cumulative = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        cumulative += latency_counts[i];
+        out << "dl_train_step_duration_seconds_bucket{le=\"" << LATENCY_BUCKETS[i] << "\"} " << cumulative << '\n';
+    }
+    out << "dl_train_step_duration_seconds_bucket{le=\"+Inf\"} " << latency_count << '\n';
+    out << "dl_train_step_duration_seconds_sum " << latency_sum << '\n';
+    out << "dl_train_step_duration_seconds_count " << latency_count << '\n';
+
+    if (events) {
+        write_metric(out, "dl_events_dropped_total", "counter",
+                     "Events dropped because the event queue was full.", events->get_dropped_events());
+    }
+
+    long long rss = resident_bytes();
+    if (rss >= 0) {
+        write_metric(out, "process_resident_memory_bytes", "gauge", "Resident memory size in bytes.", rss);
+    }
+#ifdef DL_HAVE_MALLINFO2
+    struct mallinfo2 heap = mallinfo2();
+    write_metric(out, "dl_heap_allocated_bytes", "gauge", "Bytes currently allocated on the heap.",
+                 heap.uordblks + heap.hblkhd);
+#endif
+
+    return out.str();
+}
+
+void PrometheusExporter::write_file() const {
+    std::lock_guard<std::mutex> lock(file_mutex);
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("Unable to open file: " + temporary);
+        }
+        file << render();
+        if (!file) {
+            throw std::runtime_error("Unable to write file: " + temporary);
+        }
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        throw std::runtime_error("Unable to replace file: " + path);
+    }
+}
+
+uint16_t PrometheusExporter::serve(uint16_t port, const std::string& bind_address) {
+    if (serving.load()) {
+        throw std::logic_error("PrometheusExporter is already serving.");
+    }
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw std::runtime_error("Unable to create a socket.");
+    }
+    int reuse = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    if (inet_pton(AF_INET, bind_address.c_str(), &address.sin_addr) != 1 ||
+        bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(fd, 8) != 0) {
+        close(fd);
+        throw std::runtime_error("Unable to listen on " + bind_address + ":" + std::to_string(port));
+    }
+
+    socklen_t length = sizeof(address);
+    getsockname(fd, reinterpret_cast<sockaddr*>(&address), &length);
+
+    server_socket = fd;
+    serving.store(true);
+    server = std::thread(&PrometheusExporter::serve_loop, this);
+    return ntohs(address.sin_port);
+}
+
+void PrometheusExporter::stop_serving() {
+    if (!serving.exchange(false)) {
+        return;
+    }
+    server.join();
+    close(server_socket);
+    server_socket = -1;
+}
+
+void PrometheusExporter::serve_loop() {
+    while (serving.load()) {
+        pollfd listener{server_socket, POLLIN, 0};
+        if (poll(&listener, 1, 100) <= 0) {
+            continue;
+        }
+        int client = accept(server_socket, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+
+        // The request itself is irrelevant: every path returns the exposition.
+        char request[1024];
+        pollfd reader{client, POLLIN, 0};
+        if (poll(&reader, 1, 1000) > 0) {
+            recv(client, request, sizeof(request), 0);
+        }
+
+        std::string body = render();
+        std::string response = "HTTP/1.1 200 OK\r\n"
+                               "Content-Type: text/plain; version=0.0.4\r\n"
+                               "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                               "Connection: close\r\n\r\n" + body;
+        size_t sent = 0;
+        while (sent < response.size()) {
+            ssize_t written = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (written <= 0) {
+                break;
+            }
+            sent += static_cast<size_t>(written);
+        }
+        close(client);
+    }
+}
@@ -0,0 +1,138 @@
+#ifndef PROMETHEUSEXPORTER_H
+#define PROMETHEUSEXPORTER_H
+
+#include "EventManager.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @class PrometheusExporter
+ * @brief Telemetry subscriber that exposes training metrics in the Prometheus text format.
+ *
+ * Attached to the event manager of a LossPublisher, it turns the per-step and per-epoch loss
+ * events into counters and gauges: steps, samples, samples per second, a step latency
+ * histogram, time spent waiting for the data loaders, the latest losses, dropped events,
+ * resident memory and heap usage. The metrics are rewritten to a file at most once per
+ * write interval (atomically, via rename, so the node-exporter textfile collector never
+ * reads a partial file) and can also be served over HTTP for direct scraping.
+ *
+ * All aggregation and file I/O happen on the event dispatcher thread, never on the
+ * training thread.
+ */
+class PrometheusExporter {
+private:
+    static constexpr size_t BUCKET_COUNT = 11;
+    static const std::array<double, BUCKET_COUNT> LATENCY_BUCKETS;
+
+    std::string path;
+    std::chrono::milliseconds write_interval;
+
+    mutable std::mutex mutex;
+    mutable std::mutex file_mutex;
+    EventManager* events = nullptr;
+    SubscriptionId batch_subscription = 0;
+    SubscriptionId epoch_subscription = 0;
+
+    size_t steps_total = 0;
+    size_t samples_total = 0;
+    double fetch_seconds_total = 0.0;
+    double last_loss = 0.0;
+    double last_epoch_loss = 0.0;
+    size_t epoch = 0;
+    double samples_per_second = 0.0;
+    std::array<size_t, BUCKET_COUNT> latency_counts{};
+    size_t latency_count = 0;
+    double latency_sum = 0.0;
+
+    std::chrono::steady_clock::time_point rate_window_start;
+    size_t rate_window_samples = 0;
+    std::chrono::steady_clock::time_point last_write;
+
+    std::atomic<bool> serving{false};
+    int server_socket = -1;
+    std::thread server;
+
+    /**
+     * @brief Folds a BATCH_LOSS event into the metrics.
+     */
+    void record_step(const Event& event);
+
+    /**
+     * @brief Folds a LOSS_UPDATED event into the metrics.
+     */
+    void record_epoch(const Event& event);
+
+    /**
+     * @brief Rewrites the file if the write interval elapsed.
+     */
+    void maybe_write(std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief HTTP server thread body.
+     */
+    void serve_loop();
+
+public:
+    /**
+     * @brief Constructor for PrometheusExporter.
+     * @param path File to write the metrics to (empty to only serve them over HTTP).
+     * @param write_interval Minimum time between file rewrites.
+     */
+    explicit PrometheusExporter(const std::string& path,
+                                std::chrono::milliseconds write_interval = std::chrono::milliseconds(5000));
+
+    /**
+     * @brief Detaches from the event manager, stops the HTTP endpoint and writes the file once more.
+     */
+    ~PrometheusExporter();
+
+    PrometheusExporter(const PrometheusExporter&) = delete;
+    PrometheusExporter& operator=(const PrometheusExporter&) = delete;
+
+    /**
+     * @brief Subscribes to the loss events of a publisher's event manager.
+     * The event manager must outlive the exporter or be detached first.
+     * @param event_manager E.g. LearningFacade::get_loss_publisher().get_event_manager().
+     * @throws std::logic_error if already attached.
+     */
+    void attach(EventManager& event_manager);
+
+    /**
+     * @brief Unsubscribes from the event manager, if attached.
+     */
+    void detach();
+
+    /**
+     * @brief Serves the metrics over HTTP on a background thread; every request gets the
+     * current exposition.
+     * @param port TCP port to listen on (0 picks a free port).
+     * @param bind_address IPv4 address to bind; loopback by default.
+     * @return The port actually bound.
+     * @throws std::logic_error if already serving.
+     * @throws std::runtime_error if the socket cannot be bound.
+     */
+    uint16_t serve(uint16_t port, const std::string& bind_address = "127.0.0.1");
+
+    /**
+     * @brief Stops the HTTP endpoint, if running.
+     */
+    void stop_serving();
+
+    /**
+     * @brief Renders the current metrics in the Prometheus text exposition format.
+     */
+    std::string render() const;
+
+    /**
+     * @brief Writes the metrics to the file now.
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    void write_file() const;
+};
+
+#endif // PROMETHEUSEXPORTER_H
@@ -0,0 +1,309 @@
+#include "SharedMemoryCommunicator.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct SharedMemoryCommunicator::Header {
+    std::atomic<uint64_t> ready;
+    uint64_t world_size;
+    uint64_t channel_bytes;
+    std::atomic<uint64_t> started;
+};
+
+struct SharedMemoryCommunicator::Slot {
+    std::atomic<uint64_t> token;    // written by the rank once it mapped the segment
+    std::atomic<uint64_t> ack;      // rank 0 echoes the token to admit the rank
+};
+
+struct SharedMemoryCommunicator::Channel {
+    alignas(64) std::atomic<uint64_t> written;
+    alignas(64) std::atomic<uint64_t> read;
+    alignas(64) char data[1];
+};
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr uint64_t READY_MAGIC = 0x444c52494e470001ULL;
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                  "Shared memory channels need address-free 64-bit atomics.");
+
+    size_t align_up(size_t value, size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    void wait_until(Clock::time_point deadline, const char* what) {
+        if (Clock::now() >= deadline) {
+            throw std::runtime_error(std::string("Timed out waiting for ") + what + ".");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    /**
+     * @brief Maps the segment currently behind the name, once it has at least the given size.
+     * @return The mapping, or nullptr if the segment does not exist or is not sized yet.
+     */
+    void* map_segment(const std::string& segment, size_t bytes, ino_t& inode) {
+        int fd = shm_open(segment.c_str(), O_RDWR, 0600);
+        if (fd < 0) {
+            return nullptr;
+        }
+        struct stat info {};
+        void* mapping = nullptr;
+        if (fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= bytes) {
+            mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED) {
+                mapping = nullptr;
+            } else {
+                inode = info.st_ino;
+            }
+        }
+        close(fd);
+        return mapping;
+    }
+
+    /**
+     * @brief Returns whether the name now refers to another segment than the mapped one,
+     * e.g. because rank 0 replaced a leftover segment of a crashed run.
+     */
+    bool replaced(const std::string& segment, ino_t inode) {
+        int fd = shm_open(segment.c_str(), O_RDONLY, 0);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat info {};
+        bool other = fstat(fd, &info) == 0 && info.st_ino != inode;
+        close(fd);
+        return other;
+    }
+
+    uint64_t make_token() {
+        std::random_device device;
+        std::mt19937_64 generator((static_cast<uint64_t>(device()) << 32) ^ device()
+                                  ^ static_cast<uint64_t>(Clock::now().time_since_epoch().count()));
+        uint64_t token = 0;
+        while (token == 0) {
+            token = generator();
+        }
+        return token;
+    }
+}
+
+SharedMemoryCommunicator::SharedMemoryCommunicator(size_t rank, size_t world_size, const std::string& name,
+                                                   size_t channel_bytes, std::chrono::milliseconds timeout,
+                                                   std::chrono::milliseconds stall_timeout)
+    : Communicator(rank, world_size), channel_bytes(channel_bytes), stall_timeout(stall_timeout) {
+    if (channel_bytes == 0) {
+        throw std::invalid_argument("channel_bytes must be at least 1.");
+    }
+
+    std::string segment = name.empty() || name[0] != '/' ? "/" + name : name;
+    size_t stride = align_up(offsetof(Channel, data) + channel_bytes, 64);
+    mapping_bytes = channels_offset() + world_size * stride;
+    auto deadline = Clock::now() + timeout;
+
+    if (rank == 0) {
+        shm_unlink(segment.c_str());
+        int fd = shm_open(segment.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0 || ftruncate(fd, static_cast<off_t>(mapping_bytes)) != 0) {
+            if (fd >= 0) {
+                close(fd);
+                shm_unlink(segment.c_str());
+            }
+            throw std::runtime_error("Unable to create shared memory segment " + segment);
+        }
+        mapping = mmap(nullptr, mapping_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED) {
+            mapping = nullptr;
+            shm_unlink(segment.c_str());
+            throw std::runtime_error("Unable to map shared memory segment " + segment);
+        }
+    }
+
+    try {
+        if (rank == 0) {
+            auto* header = static_cast<Header*>(mapping);
+            new (&header->started) std::atomic<uint64_t>(0);
+            header->world_size = world_size;
+            header->channel_bytes = channel_bytes;
+            for (size_t r = 0; r < world_size; ++r) {
+                new (&slot(r)->token) std::atomic<uint64_t>(0);
+                new (&slot(r)->ack) std::atomic<uint64_t>(0);
+                Channel* link = channel(r);
+                new (&link->written) std::atomic<uint64_t>(0);
+                new (&link->read) std::atomic<uint64_t>(0);
+            }
+            new (&header->ready) std::atomic<uint64_t>(0);
+            header->ready.store(READY_MAGIC, std::memory_order_release);
+
+            // Admit every rank by echoing the token it wrote into this segment.
+            std::vector<bool> admitted(world_size, false);
+            size_t attached = 1;
+            while (attached < world_size) {
+                for (size_t r = 1; r < world_size; ++r) {
+                    uint64_t token = slot(r)->token.load(std::memory_order_acquire);
+                    if (!admitted[r] && token != 0) {
+                        slot(r)->ack.store(token, std::memory_order_release);
+                        admitted[r] = true;
+                        ++attached;
+                    }
+                }
+                if (attached < world_size) {
+                    wait_until(deadline, "every rank to attach");
+                }
+            }
+            header->started.store(1, std::memory_order_release);
+        } else {
+            // A leftover segment of a crashed run may still carry the name and look initialized,
+            // but only a live rank 0 echoes this process's fresh token. Until it does, follow
+            // the name to whatever segment rank 0 creates in its place.
+            uint64_t token = make_token();
+            ino_t inode = 0;
+            bool token_written = false;
+            for (;;) {
+                if (!mapping) {
+                    mapping = map_segment(segment, mapping_bytes, inode);
+                    token_written = false;
+                    if (!mapping) {
+                        wait_until(deadline, "the shared memory segment");
+                        continue;
+                    }
+                }
+
+                auto* header = static_cast<Header*>(mapping);
+                if (header->ready.load(std::memory_order_acquire) == READY_MAGIC) {
+                    if (header->world_size != world_size || header->channel_bytes != channel_bytes) {
+                        throw std::runtime_error("Shared memory segment " + segment + " was created with a different configuration.");
+                    }
+                    if (!token_written) {
+                        slot(rank)->token.store(token, std::memory_order_release);
+                        token_written = true;
+                    }
+                    if (slot(rank)->ack.load(std::memory_order_acquire) == token) {
+                        break;
+                    }
+                }
+
+                if (replaced(segment, inode)) {
+                    munmap(mapping, mapping_bytes);
+                    mapping = nullptr;
+                    continue;
+                }
+                wait_until(deadline, "rank 0 to admit this rank");
+            }
+
+            while (static_cast<Header*>(mapping)->started.load(std::memory_order_acquire) == 0) {
+                wait_until(deadline, "every rank to attach");
+            }
+        }
+    } catch (...) {
+        if (mapping) {
+            munmap(mapping, mapping_bytes);
+            mapping = nullptr;
+        }
+        if (rank == 0) {
+            shm_unlink(segment.c_str());
+        }
+        throw;
+    }
+
+    // Every rank has mapped the segment; the name is no longer needed.
+    if (rank == 0) {
+        shm_unlink(segment.c_str());
+    }
+
+    outgoing = channel(rank);
+    incoming = channel((rank + world_size - 1) % world_size);
+}
+
+SharedMemoryCommunicator::~SharedMemoryCommunicator() {
+    if (mapping) {
+        munmap(mapping, mapping_bytes);
+    }
+}
+
+size_t SharedMemoryCommunicator::channels_offset() const {
+    return align_up(align_up(sizeof(Header), 64) + get_world_size() * sizeof(Slot), 64);
+}
+
+SharedMemoryCommunicator::Slot* SharedMemoryCommunicator::slot(size_t rank) const {
+    char* base = static_cast<char*>(mapping) + align_up(sizeof(Header), 64);
+    return reinterpret_cast<Slot*>(base) + rank;
+}
+
+SharedMemoryCommunicator::Channel* SharedMemoryCommunicator::channel(size_t writer) const {
+    size_t stride = align_up(offsetof(Channel, data) + channel_bytes, 64);
+    char* base = static_cast<char*>(mapping) + channels_offset();
+    return reinterpret_cast<Channel*>(base + writer * stride);
+}
+
+void SharedMemoryCommunicator::ring_exchange(const void* send_data, size_t send_bytes, void* receive_data, size_t receive_bytes) {
+    const char* send_cursor = static_cast<const char*>(send_data);
+    char* receive_cursor = static_cast<char*>(receive_data);
+    size_t idle_rounds = 0;
+    auto last_progress = Clock::now();
+
+    while (send_bytes > 0 || receive_bytes > 0) {
+        bool progressed = false;
+
+        if (send_bytes > 0) {
+            uint64_t written = outgoing->written.load(std::memory_order_relaxed);
+            uint64_t read = outgoing->read.load(std::memory_order_acquire);
+            size_t chunk = std::min<size_t>(send_bytes, channel_bytes - (written - read));
+            if (chunk > 0) {
+                size_t position = written % channel_bytes;
+                size_t first = std::min(chunk, channel_bytes - position);
+                std::memcpy(outgoing->data + position, send_cursor, first);
+                std::memcpy(outgoing->data, send_cursor + first, chunk - first);
+                outgoing->written.store(written + chunk, std::memory_order_release);
+                send_cursor += chunk;
+                send_bytes -= chunk;
+                progressed = true;
+            }
+        }
+
+        if (receive_bytes > 0) {
+            uint64_t read = incoming->read.load(std::memory_order_relaxed);
+            uint64_t written = incoming->written.load(std::memory_order_acquire);
+            size_t chunk = std::min<size_t>(receive_bytes, written - read);
+            if (chunk > 0) {
+                size_t position = read % channel_bytes;
+                size_t first = std::min(chunk, channel_bytes - position);
+                std::memcpy(receive_cursor, incoming->data + position, first);
+                std::memcpy(receive_cursor + first, incoming->data, chunk - first);
+                incoming->read.store(read + chunk, std::memory_order_release);
+                receive_cursor += chunk;
+                receive_bytes -= chunk;
+                progressed = true;
+            }
+        }
+
+        // Spin briefly for low latency, then give the core to the neighbours. The clock is only
+        // read once spinning failed, so the stall check stays off the fast path.
+        if (progressed) {
+            idle_rounds = 0;
+        } else if (++idle_rounds > 1000) {
+            if (idle_rounds == 1001) {
+                last_progress = Clock::now();
+            } else if (stall_timeout.count() > 0 && idle_rounds % 1024 == 0
+                       && Clock::now() - last_progress >= stall_timeout) {
+                throw std::runtime_error("No data exchanged with the neighbouring ranks for "
+                                         + std::to_string(stall_timeout.count()) + " ms; a rank may have died.");
+            }
+            std::this_thread::yield();
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef SHAREDMEMORYCOMMUNICATOR_H
+#define SHAREDMEMORYCOMMUNICATOR_H
+
+#include "Communicator.h"
+#include <chrono>
+#include <string>
+
+/**
+ * @class SharedMemoryCommunicator
+ * @brief Communicator for ranks on one host, linked through a POSIX shared memory segment.
+ *
+ * The segment holds one single-producer/single-consumer byte ring per ring link (rank r
+ * writes to channel r, rank r + 1 reads it), so data moves with two memcpy calls and no
+ * system calls. Rank 0 creates the segment, the others attach to it, and it is unlinked
+ * once every rank has mapped it. The name must be unique per job; rank 0 removes a leftover
+ * segment of the same name from a crashed run before creating its own. Ranks may start in
+ * any order: each rank writes a random token into the segment it mapped and only proceeds
+ * once rank 0 echoes it, so a rank that mapped a leftover segment keeps waiting and moves to
+ * the new segment as soon as the name refers to it.
+ */
+class SharedMemoryCommunicator : public Communicator {
+private:
+    struct Header;
+    struct Slot;
+    struct Channel;
+
+    void* mapping = nullptr;
+    size_t mapping_bytes = 0;
+    size_t channel_bytes;
+    Channel* outgoing = nullptr;
+    Channel* incoming = nullptr;
+    std::chrono::milliseconds stall_timeout;
+
+    /**
+     * @brief Returns the offset of the first channel: after the header and one slot per rank.
+     */
+    size_t channels_offset() const;
+
+    /**
+     * @brief Returns the handshake slot of the given rank.
+     */
+    Slot* slot(size_t rank) const;
+
+    /**
+     * @brief Returns the channel written by the given rank.
+     */
+    Channel* channel(size_t writer) const;
+
+public:
+    /**
+     * @brief Constructor for SharedMemoryCommunicator; blocks until every rank attached.
+     * @param rank This process's rank.
+     * @param world_size Number of ranks.
+     * @param name Segment name shared by all ranks (a leading '/' is added if missing).
+     * @param channel_bytes Capacity of each ring link; larger messages are streamed through it.
+     * @param timeout How long to wait for the other ranks.
+     * @param stall_timeout How long ring_exchange may go without moving a byte before it gives up
+     * on the neighbours; zero waits forever.
+     * @throws std::runtime_error if the segment cannot be created or the ranks do not attach in time.
+     */
+    SharedMemoryCommunicator(size_t rank, size_t world_size, const std::string& name,
+                             size_t channel_bytes = 1 << 20,
+                             std::chrono::milliseconds timeout = std::chrono::milliseconds(30000),
+                             std::chrono::milliseconds stall_timeout = std::chrono::milliseconds(60000));
+
+    /**
+     * @brief Unmaps the segment.
+     */
+    ~SharedMemoryCommunicator() override;
+
+    /**
+     * @brief Streams data into the successor's channel while draining the predecessor's.
+     * @throws std::runtime_error if no data moves in either direction for the stall timeout,
+     * e.g. because a neighbour died.
+     */
+    void ring_exchange(const void* send_data, size_t send_bytes, void* receive_data, size_t receive_bytes) override;
+};
+
+#endif // SHAREDMEMORYCOMMUNICATOR_H
@@ -0,0 +1,264 @@
+#include "SharedModelStore.h"
+#include "LinearLayer.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <typeinfo>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct SharedModelStore::Control {
+    std::atomic<uint64_t> ready;
+    std::atomic<uint64_t> version;
+    std::atomic<uint64_t> next_version;
+};
+
+namespace {
+    constexpr uint64_t CONTROL_MAGIC = 0x444c4d4f44454c01ULL;
+    constexpr uint64_t MODEL_MAGIC = 0x444c574549474801ULL;
+    constexpr size_t DATA_OFFSET = 64;
+
+    /**
+     * @brief Header at the start of every version segment; the values follow at DATA_OFFSET.
+     */
+    struct ModelHeader {
+        uint64_t magic;
+        uint64_t version;
+        uint64_t parameter_count;
+        uint64_t fingerprint;
+        uint64_t scalar_size;
+    };
+
+    static_assert(sizeof(ModelHeader) <= DATA_OFFSET, "Header must fit before the values.");
+
+    std::string control_name(const std::string& name) {
+        return name.empty() || name[0] != '/' ? "/" + name : name;
+    }
+
+    std::string version_name(const std::string& name, uint64_t version) {
+        return control_name(name) + "." + std::to_string(version);
+    }
+
+    void mix_topology(const Sequential& model, uint64_t& hash) {
+        auto mix = [&hash](const void* data, size_t bytes) {
+            const auto* cursor = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < bytes; ++i) {
+                hash = (hash ^ cursor[i]) * 1099511628211ULL;
+            }
+        };
+        for (const auto& module : model.get_modules()) {
+            const char* type = typeid(*module).name();
+            uint64_t count = module->parameter_count();
+            mix(type, std::strlen(type));
+            mix(&count, sizeof(count));
+
+            // Equal counts do not imply equal shapes, e.g. LinearLayer(1, 8) and (3, 4).
+            if (const auto* linear = dynamic_cast<const LinearLayer*>(module.get())) {
+                uint64_t shape[2] = {linear->get_input_size(), linear->get_output_size()};
+                mix(shape, sizeof(shape));
+            } else if (const auto* nested = dynamic_cast<const Sequential*>(module.get())) {
+                mix_topology(*nested, hash);
+            }
+        }
+    }
+
+    /**
+     * @brief FNV-1a hash of the module types, parameter counts and layer shapes, to reject
+     * a worker model whose topology differs from the published one.
+     */
+    uint64_t fingerprint(const Sequential& model) {
+        uint64_t hash = 1469598103934665603ULL;
+        mix_topology(model, hash);
+        return hash;
+    }
+}
+
+SharedModelStore::SharedModelStore(const std::string& name) : name(name) {
+    std::string segment = control_name(name);
+
+    int fd = shm_open(segment.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    bool created = fd >= 0;
+    if (!created) {
+        if (errno != EEXIST) {
+            throw std::runtime_error("Unable to create shared memory segment " + segment);
+        }
+        fd = shm_open(segment.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            throw std::runtime_error("Unable to open shared memory segment " + segment);
+        }
+        // The creator may still be sizing it.
+        struct stat info {};
+        for (int attempt = 0; fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) < sizeof(Control); ++attempt) {
+            if (attempt == 1000) {
+                close(fd);
+                throw std::runtime_error("Shared memory segment " + segment + " was never initialized.");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    } else if (ftruncate(fd, sizeof(Control)) != 0) {
+        close(fd);
+        shm_unlink(segment.c_str());
+        throw std::runtime_error("Unable to size shared memory segment " + segment);
+    }
+
+    void* mapping = mmap(nullptr, sizeof(Control), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("Unable to map shared memory segment " + segment);
+    }
+    control = static_cast<Control*>(mapping);
+
+    if (created) {
+        new (&control->version) std::atomic<uint64_t>(0);
+        new (&control->next_version) std::atomic<uint64_t>(0);
+        control->ready.store(CONTROL_MAGIC, std::memory_order_release);
+    } else {
+        for (int attempt = 0; control->ready.load(std::memory_order_acquire) != CONTROL_MAGIC; ++attempt) {
+            if (attempt == 1000) {
+                munmap(control, sizeof(Control));
+                throw std::runtime_error("Shared memory segment " + segment + " is not a model store.");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+SharedModelStore::~SharedModelStore() {
+    munmap(control, sizeof(Control));
+}
+
+uint64_t SharedModelStore::publish(const Sequential& model) {
+    ParameterView values = model.parameters();
+    uint64_t version = control->next_version.fetch_add(1, std::memory_order_acq_rel) + 1;
+    std::string segment = version_name(name, version);
+    size_t bytes = DATA_OFFSET + values.size * sizeof(long double);
+
+    int fd = shm_open(segment.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Unable to create shared memory segment " + segment);
+    }
+    void* mapping = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(bytes)) == 0) {
+        mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        shm_unlink(segment.c_str());
+        throw std::runtime_error("Unable to map shared memory segment " + segment);
+    }
+
+    ModelHeader header{MODEL_MAGIC, version, values.size, fingerprint(model), sizeof(long double)};
+    std::memcpy(mapping, &header, sizeof(header));
+    std::copy(values.begin(), values.end(), reinterpret_cast<long double*>(static_cast<char*>(mapping) + DATA_OFFSET));
+    munmap(mapping, bytes);
+
+    // Only ever move forward, in case another publisher finished a later version first.
+    uint64_t previous = control->version.load(std::memory_order_acquire);
+    while (previous < version &&
+           !control->version.compare_exchange_weak(previous, version, std::memory_order_acq_rel)) {}
+
+    if (previous < version) {
+        if (previous != 0) {
+            shm_unlink(version_name(name, previous).c_str());
+        }
+    } else {
+        shm_unlink(segment.c_str());
+    }
+    return version;
+}
+
+uint64_t SharedModelStore::bind_current(Sequential& model) {
+    // A publish may unlink the version we just read; retry with the newer one.
+    for (int attempt = 0; attempt < 16; ++attempt) {
+        uint64_t version = control->version.load(std::memory_order_acquire);
+        if (version == 0) {
+            throw std::runtime_error("No model has been published to store " + name);
+        }
+
+        std::string segment = version_name(name, version);
+        int fd = shm_open(segment.c_str(), O_RDONLY, 0);
+        if (fd < 0) {
+            if (errno == ENOENT && control->version.load(std::memory_order_acquire) != version) {
+                continue;
+            }
+            throw std::runtime_error("Unable to open shared memory segment " + segment);
+        }
+        struct stat info {};
+        void* mapping = MAP_FAILED;
+        if (fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= DATA_OFFSET) {
+            mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error("Unable to map shared memory segment " + segment);
+        }
+
+        size_t bytes = static_cast<size_t>(info.st_size);
+        std::shared_ptr<const void> owner(mapping, [bytes](const void* address) {
+            munmap(const_cast<void*>(address), bytes);
+        });
+
+        ModelHeader header;
+        std::memcpy(&header, mapping, sizeof(header));
+        if (header.magic != MODEL_MAGIC || header.version != version || header.scalar_size != sizeof(long double) ||
+            DATA_OFFSET + header.parameter_count * sizeof(long double) > bytes) {
+            throw std::runtime_error("Shared memory segment " + segment + " does not hold a model.");
+        }
+        if (header.parameter_count != model.parameter_count() || header.fingerprint != fingerprint(model)) {
+            throw std::runtime_error("The published model does not match the topology of the attached model.");
+        }
+
+        const auto* values = reinterpret_cast<const long double*>(static_cast<const char*>(mapping) + DATA_OFFSET);
+        model.bind_parameters(std::make_shared<ParameterStore>(values, header.parameter_count, owner), 0);
+        model.refresh_parameters();
+        attached_version = version;
+        return version;
+    }
+    throw std::runtime_error("Store " + name + " changed too often to attach.");
+}
+
+uint64_t SharedModelStore::attach(Sequential& model) {
+    return bind_current(model);
+}
+
+bool SharedModelStore::refresh(Sequential& model) {
+    if (control->version.load(std::memory_order_acquire) == attached_version) {
+        return false;
+    }
+    bind_current(model);
+    return true;
+}
+
+uint64_t SharedModelStore::get_version() const {
+    return control->version.load(std::memory_order_acquire);
+}
+
+uint64_t SharedModelStore::get_attached_version() const {
+    return attached_version;
+}
+
+void SharedModelStore::remove(const std::string& name) {
+    std::string segment = control_name(name);
+    int fd = shm_open(segment.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return;
+    }
+    void* mapping = mmap(nullptr, sizeof(Control), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping != MAP_FAILED) {
+        uint64_t version = static_cast<Control*>(mapping)->version.load(std::memory_order_acquire);
+        if (version != 0) {
+            shm_unlink(version_name(name, version).c_str());
+        }
+        munmap(mapping, sizeof(Control));
+    }
+    shm_unlink(segment.c_str());
+}
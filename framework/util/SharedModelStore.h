@@ -0,0 +1,94 @@
+#ifndef SHAREDMODELSTORE_H
+#define SHAREDMODELSTORE_H
+
+#include "SequentialNN.h"
+#include <cstdint>
+#include <string>
+
+/**
+ * @class SharedModelStore
+ * @brief Publishes model weights into POSIX shared memory for many scoring processes.
+ *
+ * A small control segment named after the store holds the current version. Every published
+ * version lives in its own segment (name.version) with a header describing the model, and is
+ * written completely before the version number is switched, so readers never see a partial
+ * model. Workers bind their Sequential to the mapping read-only and run predict() directly on
+ * the shared weights: each host keeps one copy of the weights however many workers it runs.
+ *
+ * Hot swap: a worker calls refresh() between requests. It costs one atomic load when nothing
+ * changed; after a publish it maps the new version and rebinds the model. The previous segment
+ * is unlinked by the publisher, and its memory is freed once the last worker has moved on.
+ * Segments outlive the publishing process; remove() deletes them.
+ */
+class SharedModelStore {
+private:
+    struct Control;
+
+    std::string name;
+    Control* control = nullptr;
+    uint64_t attached_version = 0;
+
+    /**
+     * @brief Maps the current version read-only and binds the model to it.
+     * @return The version bound.
+     */
+    uint64_t bind_current(Sequential& model);
+
+public:
+    /**
+     * @brief Opens the store, creating its control segment if it does not exist yet.
+     * @param name Store name shared by the publisher and the workers.
+     * @throws std::runtime_error if the control segment cannot be created or mapped.
+     */
+    explicit SharedModelStore(const std::string& name);
+
+    /**
+     * @brief Unmaps the control segment; the shared segments stay in place.
+     */
+    ~SharedModelStore();
+
+    SharedModelStore(const SharedModelStore&) = delete;
+    SharedModelStore& operator=(const SharedModelStore&) = delete;
+
+    /**
+     * @brief Copies the model's parameters into a new version and makes it current.
+     * @param model The trained model.
+     * @return The new version number.
+     * @throws std::runtime_error if the segment cannot be created.
+     */
+    uint64_t publish(const Sequential& model);
+
+    /**
+     * @brief Binds a model to the current version; the model becomes inference-only.
+     * @param model A Sequential with the published topology (parameters are replaced).
+     * @return The version bound.
+     * @throws std::runtime_error if nothing is published or the topology differs.
+     */
+    uint64_t attach(Sequential& model);
+
+    /**
+     * @brief Rebinds an attached model if a newer version was published.
+     * Must not run concurrently with inference on the same model.
+     * @param model The model passed to attach.
+     * @return True if the model was switched to a new version.
+     */
+    bool refresh(Sequential& model);
+
+    /**
+     * @brief Returns the current published version (0 if none).
+     */
+    uint64_t get_version() const;
+
+    /**
+     * @brief Returns the version the attached model runs (0 if not attached).
+     */
+    uint64_t get_attached_version() const;
+
+    /**
+     * @brief Unlinks the control segment and the current version of a store.
+     * @param name The store name.
+     */
+    static void remove(const std::string& name);
+};
+
+#endif // SHAREDMODELSTORE_H
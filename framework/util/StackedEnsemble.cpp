@@ -0,0 +1,494 @@
+#include "StackedEnsemble.h"
+#include "LinearLayer.h"
+#include "ActivationLayer.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    constexpr size_t PANEL_SIZE = 4;
+
+    struct LayerShape {
+        std::shared_ptr<LinearLayer> linear;
+        ActivationKind activation = ActivationKind::Identity;
+    };
+
+    void flatten(const Sequential& model, std::vector<std::shared_ptr<Module>>& modules) {
+        for (const auto& module : model.get_modules()) {
+            if (const auto* nested = dynamic_cast<const Sequential*>(module.get())) {
+                flatten(*nested, modules);
+            } else {
+                modules.push_back(module);
+            }
+        }
+    }
+
+    /**
+     * @brief Splits a model into linear layers and the activation following each one.
+     */
+    std::vector<LayerShape> describe(const Sequential& model) {
+        std::vector<std::shared_ptr<Module>> modules;
+        flatten(model, modules);
+
+        std::vector<LayerShape> shapes;
+        for (const auto& module : modules) {
+            if (auto linear = std::dynamic_pointer_cast<LinearLayer>(module)) {
+                shapes.push_back({linear, ActivationKind::Identity});
+                continue;
+            }
+            const auto* activation = dynamic_cast<const ActivationLayer*>(module.get());
+            if (!activation || activation->kind() == ActivationKind::Custom) {
+                throw std::invalid_argument("Ensemble members may only contain linear layers and built-in activations.");
+            }
+            if (activation->kind() == ActivationKind::Identity) {
+                continue;
+            }
+            if (shapes.empty() || shapes.back().activation != ActivationKind::Identity) {
+                throw std::invalid_argument("Every activation of an ensemble member must follow a linear layer.");
+            }
+            shapes.back().activation = activation->kind();
+        }
+        if (shapes.empty()) {
+            throw std::invalid_argument("Ensemble members need at least one linear layer.");
+        }
+        for (size_t l = 1; l < shapes.size(); ++l) {
+            if (shapes[l - 1].linear->get_output_size() != shapes[l].linear->get_input_size()) {
+                throw std::invalid_argument("Layer sizes of the ensemble member do not chain.");
+            }
+        }
+        return shapes;
+    }
+
+    long double activate(ActivationKind kind, long double value) {
+        switch (kind) {
+            case ActivationKind::ReLU: return std::max(0.0L, value);
+            case ActivationKind::Sigmoid: return 1.0L / (1.0L + std::exp(-value));
+            case ActivationKind::Tanh: return std::tanh(value);
+            default: return value;
+        }
+    }
+
+    // Same values as Activations::*_derivative, computed from the activation's output.
+    long double derivative_from_output(ActivationKind kind, long double output) {
+        switch (kind) {
+            case ActivationKind::ReLU: return output > 0.0L ? 1.0L : 0.0L;
+            case ActivationKind::Sigmoid: return output * (1.0L - output);
+            case ActivationKind::Tanh: return 1.0L - output * output;
+            default: return 1.0L;
+        }
+    }
+
+    /**
+     * @brief Batched matrix multiply over all members:
+     * outputs[b][m][o] = biases[m][o] + sum_i inputs[b][m][i] * weights[m][o][i].
+     * PANEL_SIZE weight rows are swept together so every input load feeds PANEL_SIZE
+     * accumulators, and each panel stays in cache for the whole batch. Each output is summed
+     * in input order, like LinearLayer::predict, so results match the members bit for bit.
+     * @param input_row_stride Distance between rows of the input.
+     * @param input_member_stride Distance between the inputs of consecutive members (0 when shared).
+     */
+    void stacked_gemm(const long double* inputs, size_t input_row_stride, size_t input_member_stride,
+                      const long double* weights, const long double* biases, size_t members,
+                      size_t input_size, size_t output_size, size_t batch_size, long double* outputs) {
+        size_t output_row_stride = members * output_size;
+        for (size_t m = 0; m < members; ++m) {
+            const long double* member_weights = weights + m * output_size * input_size;
+            const long double* member_biases = biases + m * output_size;
+            long double* member_outputs = outputs + m * output_size;
+            const long double* member_inputs = inputs + m * input_member_stride;
+
+            size_t o = 0;
+            for (; o + PANEL_SIZE <= output_size; o += PANEL_SIZE) {
+                const long double* w0 = member_weights + o * input_size;
+                const long double* w1 = w0 + input_size;
+                const long double* w2 = w1 + input_size;
+                const long double* w3 = w2 + input_size;
+                for (size_t b = 0; b < batch_size; ++b) {
+                    const long double* x = member_inputs + b * input_row_stride;
+                    long double a0 = member_biases[o];
+                    long double a1 = member_biases[o + 1];
+                    long double a2 = member_biases[o + 2];
+                    long double a3 = member_biases[o + 3];
+                    for (size_t i = 0; i < input_size; ++i) {
+                        long double xi = x[i];
+                        a0 += xi * w0[i];
+                        a1 += xi * w1[i];
+                        a2 += xi * w2[i];
+                        a3 += xi * w3[i];
+                    }
+                    long double* y = member_outputs + b * output_row_stride + o;
+                    y[0] = a0;
+                    y[1] = a1;
+                    y[2] = a2;
+                    y[3] = a3;
+                }
+            }
+            for (; o < output_size; ++o) {
+                const long double* w = member_weights + o * input_size;
+                for (size_t b = 0; b < batch_size; ++b) {
+                    const long double* x = member_inputs + b * input_row_stride;
+                    long double a = member_biases[o];
+                    for (size_t i = 0; i < input_size; ++i) {
+                        a += x[i] * w[i];
+                    }
+                    member_outputs[b * output_row_stride + o] = a;
+                }
+            }
+        }
+    }
+    /**
+     * @brief Steps the given members of one stacked block ([member][member_size]) and zeroes
+     * the block's gradients. Each member is a row of Optimizer::sparse_step, so it keeps its
+     * own optimizer state and members left out neither move nor advance that state.
+     */
+    void step_members(Optimizer& optimizer, long double* values, long double* gradients, size_t member_count,
+                      size_t member_size, const std::vector<size_t>& members) {
+        // Compact the gradients of the stepped members in place, as sparse_step expects.
+        for (size_t r = 0; r < members.size(); ++r) {
+            if (members[r] != r) {
+                std::copy_n(gradients + members[r] * member_size, member_size, gradients + r * member_size);
+            }
+        }
+        optimizer.sparse_step({values, member_count * member_size}, member_size, members, gradients, 1.0L);
+        std::fill_n(gradients, member_count * member_size, 0.0L);
+    }
+}
+
+StackedEnsemble::StackedEnsemble(const std::vector<Sequential>& members) : member_count(members.size()) {
+    if (members.empty()) {
+        throw std::invalid_argument("An ensemble needs at least one member.");
+    }
+
+    std::vector<std::vector<LayerShape>> shapes;
+    for (const auto& member : members) {
+        shapes.push_back(describe(member));
+    }
+
+    size_t offset = 0;
+    for (size_t l = 0; l < shapes[0].size(); ++l) {
+        Layer layer{shapes[0][l].linear->get_input_size(), shapes[0][l].linear->get_output_size(),
+                    shapes[0][l].activation, 0, 0};
+        layer.weight_offset = offset;
+        offset += member_count * layer.output_size * layer.input_size;
+        layer.bias_offset = offset;
+        offset += member_count * layer.output_size;
+        layers.push_back(layer);
+    }
+    for (const auto& member : shapes) {
+        if (member.size() != layers.size()) {
+            throw std::invalid_argument("Ensemble members must have the same topology.");
+        }
+        for (size_t l = 0; l < layers.size(); ++l) {
+            if (member[l].linear->get_input_size() != layers[l].input_size ||
+                member[l].linear->get_output_size() != layers[l].output_size ||
+                member[l].activation != layers[l].activation) {
+                throw std::invalid_argument("Ensemble members must have the same topology.");
+            }
+        }
+    }
+
+    store = std::make_shared<ParameterStore>(offset);
+    ParameterView values = store->values_view(0, offset);
+    for (size_t m = 0; m < member_count; ++m) {
+        for (size_t l = 0; l < layers.size(); ++l) {
+            const Layer& layer = layers[l];
+            ParameterView weights = shapes[m][l].linear->get_weights();
+            ParameterView biases = shapes[m][l].linear->get_biases();
+            std::copy(weights.begin(), weights.end(),
+                      values.data + layer.weight_offset + m * layer.output_size * layer.input_size);
+            std::copy(biases.begin(), biases.end(), values.data + layer.bias_offset + m * layer.output_size);
+        }
+    }
+    member_rows.resize(member_count);
+}
+
+size_t StackedEnsemble::size() const {
+    return member_count;
+}
+
+size_t StackedEnsemble::get_input_size() const {
+    return layers.front().input_size;
+}
+
+size_t StackedEnsemble::get_output_size() const {
+    return layers.back().output_size;
+}
+
+void StackedEnsemble::forward_batch(const long double* inputs, size_t batch_size,
+                                    std::vector<std::vector<long double>>& activations) const {
+    const long double* values = store->values_view(0, store->size()).data;
+    activations.resize(layers.size());
+
+    for (size_t l = 0; l < layers.size(); ++l) {
+        const Layer& layer = layers[l];
+        bool shared_input = l == 0;
+        const long double* layer_inputs = shared_input ? inputs : activations[l - 1].data();
+        std::vector<long double>& outputs = activations[l];
+        outputs.resize(batch_size * member_count * layer.output_size);
+
+        stacked_gemm(layer_inputs,
+                     shared_input ? layer.input_size : member_count * layer.input_size,
+                     shared_input ? 0 : layer.input_size,
+                     values + layer.weight_offset, values + layer.bias_offset, member_count,
+                     layer.input_size, layer.output_size, batch_size, outputs.data());
+
+        if (layer.activation != ActivationKind::Identity) {
+            for (auto& value : outputs) {
+                value = activate(layer.activation, value);
+            }
+        }
+    }
+}
+
+void StackedEnsemble::backward_batch(const long double* inputs, size_t batch_size,
+                                     const std::vector<std::vector<long double>>& activations,
+                                     std::vector<long double>& output_gradients) {
+    const long double* values = store->values_view(0, store->size()).data;
+    long double* gradients = store->gradients_view(0, store->size()).data;
+    std::vector<long double> input_gradients;
+
+    for (size_t l = layers.size(); l-- > 0;) {
+        const Layer& layer = layers[l];
+        size_t in = layer.input_size;
+        size_t out = layer.output_size;
+        bool shared_input = l == 0;
+        const long double* layer_inputs = shared_input ? inputs : activations[l - 1].data();
+        size_t input_row_stride = shared_input ? in : member_count * in;
+        size_t input_member_stride = shared_input ? 0 : in;
+
+        if (layer.activation != ActivationKind::Identity) {
+            const std::vector<long double>& outputs = activations[l];
+            for (size_t k = 0; k < output_gradients.size(); ++k) {
+                output_gradients[k] *= derivative_from_output(layer.activation, outputs[k]);
+            }
+        }
+
+        // Weight gradients, summed over the batch in row order.
+        for (size_t m = 0; m < member_count; ++m) {
+            for (size_t o = 0; o < out; ++o) {
+                long double* weight_gradients = gradients + layer.weight_offset + (m * out + o) * in;
+                long double& bias_gradient = gradients[layer.bias_offset + m * out + o];
+                for (size_t b = 0; b < batch_size; ++b) {
+                    long double g = output_gradients[(b * member_count + m) * out + o];
+                    if (g == 0.0L) {
+                        continue;
+                    }
+                    const long double* x = layer_inputs + b * input_row_stride + m * input_member_stride;
+                    for (size_t i = 0; i < in; ++i) {
+                        weight_gradients[i] += g * x[i];
+                    }
+                    bias_gradient += g;
+                }
+            }
+        }
+
+        if (shared_input) {
+            break;   // the data needs no gradient
+        }
+
+        input_gradients.assign(batch_size * member_count * in, 0.0L);
+        for (size_t b = 0; b < batch_size; ++b) {
+            for (size_t m = 0; m < member_count; ++m) {
+                const long double* g = output_gradients.data() + (b * member_count + m) * out;
+                long double* dx = input_gradients.data() + (b * member_count + m) * in;
+                const long double* member_weights = values + layer.weight_offset + m * out * in;
+                for (size_t o = 0; o < out; ++o) {
+                    const long double* w = member_weights + o * in;
+                    for (size_t i = 0; i < in; ++i) {
+                        dx[i] += g[o] * w[i];
+                    }
+                }
+            }
+        }
+        output_gradients.swap(input_gradients);
+    }
+}
+
+std::vector<std::vector<long double>> StackedEnsemble::predict_members(
+    const std::vector<std::vector<long double>>& inputs) const {
+    size_t in = get_input_size();
+    size_t width = member_count * get_output_size();
+
+    std::vector<long double> batch(inputs.size() * in);
+    for (size_t b = 0; b < inputs.size(); ++b) {
+        if (inputs[b].size() != in) {
+            throw std::invalid_argument("Input size does not match the ensemble's input size.");
+        }
+        std::copy(inputs[b].begin(), inputs[b].end(), batch.begin() + b * in);
+    }
+
+    std::vector<std::vector<long double>> activations;
+    forward_batch(batch.data(), inputs.size(), activations);
+
+    std::vector<std::vector<long double>> outputs(inputs.size());
+    for (size_t b = 0; b < inputs.size(); ++b) {
+        outputs[b].assign(activations.back().begin() + b * width, activations.back().begin() + (b + 1) * width);
+    }
+    return outputs;
+}
+
+std::vector<long double> StackedEnsemble::predict(const std::vector<long double>& inputs) const {
+    if (inputs.size() != get_input_size()) {
+        throw std::invalid_argument("Input size does not match the ensemble's input size.");
+    }
+    std::vector<std::vector<long double>> activations;
+    forward_batch(inputs.data(), 1, activations);
+
+    size_t out = get_output_size();
+    std::vector<long double> mean(out, 0.0L);
+    for (size_t m = 0; m < member_count; ++m) {
+        for (size_t o = 0; o < out; ++o) {
+            mean[o] += activations.back()[m * out + o];
+        }
+    }
+    for (auto& value : mean) {
+        value /= member_count;
+    }
+    return mean;
+}
+
+void StackedEnsemble::set_member_rows(size_t member, std::vector<bool> rows) {
+    if (member >= member_count) {
+        throw std::out_of_range("Ensemble member index out of range.");
+    }
+    member_rows[member] = std::move(rows);
+}
+
+std::vector<long double> StackedEnsemble::train(Iterator& train_loader, Iterator& target_loader,
+                                                const LossFunction& loss_function, Optimizer& optimizer,
+                                                size_t epochs, size_t batch_size) {
+    if (batch_size == 0) {
+        throw std::invalid_argument("batch_size must be at least 1.");
+    }
+
+    size_t in = get_input_size();
+    size_t out = get_output_size();
+    ParameterView values = store->values_view(0, store->size());
+    ParameterView gradients = store->gradients_view(0, values.size);
+
+    auto trains_on = [this](size_t member, size_t row) {
+        const std::vector<bool>& rows = member_rows[member];
+        if (rows.empty()) {
+            return true;
+        }
+        if (row >= rows.size()) {
+            throw std::invalid_argument("The row selection of a member is shorter than the training data.");
+        }
+        return static_cast<bool>(rows[row]);
+    };
+
+    std::vector<long double> batch_inputs;
+    std::vector<long double> batch_targets;
+    std::vector<std::vector<long double>> activations;
+    std::vector<long double> output_gradients;
+    std::vector<long double> epoch_loss(member_count);
+    std::vector<size_t> epoch_rows(member_count);
+    std::vector<size_t> batch_rows(member_count);
+    std::vector<size_t> trained_members;
+
+    for (size_t epoch = 0; epoch < epochs; ++epoch) {
+        std::fill(epoch_loss.begin(), epoch_loss.end(), 0.0L);
+        std::fill(epoch_rows.begin(), epoch_rows.end(), 0);
+        train_loader.reset();
+        target_loader.reset();
+        size_t row = 0;
+
+        while (train_loader.has_more() && target_loader.has_more()) {
+            size_t first_row = row;
+            size_t target_size = 0;
+            batch_inputs.clear();
+            batch_targets.clear();
+            for (; row - first_row < batch_size && train_loader.has_more() && target_loader.has_more(); ++row) {
+                const auto& input = train_loader.get_next();
+                const auto& target = target_loader.get_next();
+                if (input.size() != in) {
+                    throw std::invalid_argument("Input size does not match the ensemble's input size.");
+                }
+                target_size = target.size();
+                batch_inputs.insert(batch_inputs.end(), input.begin(), input.end());
+                batch_targets.insert(batch_targets.end(), target.begin(), target.end());
+            }
+            size_t rows = row - first_row;
+
+            forward_batch(batch_inputs.data(), rows, activations);
+            const std::vector<long double>& outputs = activations.back();
+            output_gradients.assign(outputs.size(), 0.0L);
+            std::fill(batch_rows.begin(), batch_rows.end(), 0);
+
+            for (size_t b = 0; b < rows; ++b) {
+                for (size_t m = 0; m < member_count; ++m) {
+                    if (!trains_on(m, first_row + b)) {
+                        continue;
+                    }
+                    size_t at = (b * member_count + m) * out;
+                    epoch_loss[m] += loss_function.compute_loss_and_gradient(
+                        outputs.data() + at, batch_targets.data() + b * target_size,
+                        output_gradients.data() + at, 1, out);
+                    ++epoch_rows[m];
+                    ++batch_rows[m];
+                }
+            }
+
+            backward_batch(batch_inputs.data(), rows, activations, output_gradients);
+
+            // Average each member over its own rows and step only the members that trained on
+            // the batch; the others keep their weights and optimizer state untouched.
+            trained_members.clear();
+            for (size_t m = 0; m < member_count; ++m) {
+                if (batch_rows[m] > 0) {
+                    trained_members.push_back(m);
+                }
+            }
+            for (const Layer& layer : layers) {
+                size_t weight_count = layer.output_size * layer.input_size;
+                for (size_t m : trained_members) {
+                    long double scale = 1.0L / batch_rows[m];
+                    long double* weight_gradients = gradients.data + layer.weight_offset + m * weight_count;
+                    long double* bias_gradients = gradients.data + layer.bias_offset + m * layer.output_size;
+                    for (size_t k = 0; k < weight_count; ++k) {
+                        weight_gradients[k] *= scale;
+                    }
+                    for (size_t k = 0; k < layer.output_size; ++k) {
+                        bias_gradients[k] *= scale;
+                    }
+                }
+                step_members(optimizer, values.data + layer.weight_offset, gradients.data + layer.weight_offset,
+                             member_count, weight_count, trained_members);
+                step_members(optimizer, values.data + layer.bias_offset, gradients.data + layer.bias_offset,
+                             member_count, layer.output_size, trained_members);
+            }
+        }
+    }
+
+    std::vector<long double> losses(member_count, 0.0L);
+    for (size_t m = 0; m < member_count; ++m) {
+        if (epoch_rows[m] > 0) {
+            losses[m] = epoch_loss[m] / epoch_rows[m];
+        }
+    }
+    return losses;
+}
+
+void StackedEnsemble::copy_member_to(size_t member, Sequential& model) const {
+    if (member >= member_count) {
+        throw std::out_of_range("Ensemble member index out of range.");
+    }
+    std::vector<LayerShape> shapes = describe(model);
+    if (shapes.size() != layers.size()) {
+        throw std::invalid_argument("The model does not match the ensemble's topology.");
+    }
+
+    const long double* values = store->values_view(0, store->size()).data;
+    for (size_t l = 0; l < layers.size(); ++l) {
+        const Layer& layer = layers[l];
+        if (shapes[l].linear->get_input_size() != layer.input_size ||
+            shapes[l].linear->get_output_size() != layer.output_size || shapes[l].activation != layer.activation) {
+            throw std::invalid_argument("The model does not match the ensemble's topology.");
+        }
+        const long double* weights = values + layer.weight_offset + member * layer.output_size * layer.input_size;
+        const long double* biases = values + layer.bias_offset + member * layer.output_size;
+        std::copy(weights, weights + layer.output_size * layer.input_size, shapes[l].linear->get_weights().data);
+        std::copy(biases, biases + layer.output_size, shapes[l].linear->get_biases().data);
+    }
+    model.refresh_parameters();
+}
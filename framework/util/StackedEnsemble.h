@@ -0,0 +1,143 @@
+#ifndef STACKEDENSEMBLE_H
+#define STACKEDENSEMBLE_H
+
+#include "SequentialNN.h"
+#include "LossFunction.h"
+#include "Optimizer.h"
+#include "Iterator.h"
+#include "Activations.h"
+#include <memory>
+#include <vector>
+
+/**
+ * @class StackedEnsemble
+ * @brief Runs and trains M models of the same topology as one stacked model.
+ *
+ * The weights of every member are copied into one ParameterStore, layer by layer, as
+ * [member][output][input] followed by the biases [member][output]. A batch of rows then
+ * goes through each layer in a single batched matrix multiply over all members, instead
+ * of M * rows small matrix-vector products: the first layer reads each input row once for
+ * the whole ensemble, and every weight panel is reused across the batch while in cache.
+ *
+ * Members are Sequentials of LinearLayers, each optionally followed by an ActivationLayer
+ * with a built-in activation (nested Sequentials are flattened). Training updates all
+ * members at once, each with its own optimizer state; members can train on different rows
+ * (e.g. k-fold) through set_member_rows, and differ otherwise only by their initial weights.
+ */
+class StackedEnsemble {
+private:
+    /**
+     * @brief One stacked LinearLayer and the activation following it.
+     */
+    struct Layer {
+        size_t input_size;
+        size_t output_size;
+        ActivationKind activation;
+        size_t weight_offset;   // M * output * input weights
+        size_t bias_offset;     // M * output biases
+    };
+
+    size_t member_count;
+    std::vector<Layer> layers;
+    std::shared_ptr<ParameterStore> store;
+    std::vector<std::vector<bool>> member_rows;
+
+    /**
+     * @brief Runs a contiguous batch through every layer.
+     * @param inputs Row-major batch_size x input_size inputs, shared by every member.
+     * @param batch_size Number of rows.
+     * @param activations Receives the output of every layer, [row][member][output].
+     */
+    void forward_batch(const long double* inputs, size_t batch_size,
+                       std::vector<std::vector<long double>>& activations) const;
+
+    /**
+     * @brief Backpropagates through every layer, accumulating into the store's gradients.
+     * @param inputs The inputs passed to forward_batch.
+     * @param batch_size Number of rows.
+     * @param activations The layer outputs computed by forward_batch.
+     * @param output_gradients Gradient of the loss with respect to the last outputs; overwritten.
+     */
+    void backward_batch(const long double* inputs, size_t batch_size,
+                        const std::vector<std::vector<long double>>& activations,
+                        std::vector<long double>& output_gradients);
+
+public:
+    /**
+     * @brief Stacks the current weights of the members.
+     * @param members Models with identical topology; at least one.
+     * @throws std::invalid_argument if the list is empty, a model has an unsupported module,
+     * or the topologies differ.
+     */
+    explicit StackedEnsemble(const std::vector<Sequential>& members);
+
+    /**
+     * @brief Returns the number of members.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the number of input features.
+     */
+    size_t get_input_size() const;
+
+    /**
+     * @brief Returns the number of outputs of one member.
+     */
+    size_t get_output_size() const;
+
+    /**
+     * @brief Returns the outputs of every member for a batch of rows.
+     * @param inputs The input rows.
+     * @return One vector per row with the outputs of every member, [member][output].
+     * @throws std::invalid_argument if a row has the wrong size.
+     */
+    std::vector<std::vector<long double>> predict_members(const std::vector<std::vector<long double>>& inputs) const;
+
+    /**
+     * @brief Returns the ensemble output for one row: the mean of the member outputs.
+     * @param inputs The input row.
+     * @return The averaged outputs.
+     */
+    std::vector<long double> predict(const std::vector<long double>& inputs) const;
+
+    /**
+     * @brief Restricts the training rows of a member.
+     * @param member The member index.
+     * @param rows One flag per training row, in loader order; an empty vector uses every row.
+     * @throws std::out_of_range if the member does not exist.
+     */
+    void set_member_rows(size_t member, std::vector<bool> rows);
+
+    /**
+     * @brief Trains every member at once.
+     * Each batch is forwarded and backpropagated through all members together. Each member's
+     * gradients are averaged over the rows of the batch it trains on, and only the members
+     * with rows in the batch are stepped, through Optimizer::sparse_step with one row per
+     * member: momentum, moments and weight decay of a member advance only on its own batches.
+     * With batch_size = 1 a member thus follows exactly the steps LearningFacade::train would
+     * take on it with the same optimizer settings (SGD with or without momentum, Adam, AdamW).
+     * Custom optimizers must override sparse_step to be applied here.
+     * @param train_loader Training data loader.
+     * @param target_loader Target data loader.
+     * @param loss_function The loss function.
+     * @param optimizer Optimizer stepping the members; its sparse state is kept per member.
+     * @param epochs Number of epochs.
+     * @param batch_size Rows per optimizer step.
+     * @return The average loss of each member in the last epoch.
+     * @throws std::invalid_argument if batch_size is zero or a row mask is shorter than the data.
+     */
+    std::vector<long double> train(Iterator& train_loader, Iterator& target_loader, const LossFunction& loss_function,
+                                   Optimizer& optimizer, size_t epochs, size_t batch_size = 32);
+
+    /**
+     * @brief Copies the weights of one member into a model of the same topology,
+     * e.g. the Sequential it was stacked from.
+     * @param member The member index.
+     * @param model The model to overwrite.
+     * @throws std::invalid_argument if the topology differs.
+     */
+    void copy_member_to(size_t member, Sequential& model) const;
+};
+
+#endif // STACKEDENSEMBLE_H
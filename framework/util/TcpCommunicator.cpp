@@ -0,0 +1,194 @@
+#include "TcpCommunicator.h"
+#include <cerrno>
+#include <stdexcept>
+#include <thread>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    sockaddr_in make_address(const std::string& host, uint16_t port) {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        if (inet_pton(AF_INET, host.c_str(), &address.sin_addr) != 1) {
+            throw std::invalid_argument("Invalid IPv4 address: " + host);
+        }
+        return address;
+    }
+
+    int milliseconds_left(Clock::time_point deadline) {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+        return left > 0 ? static_cast<int>(left) : 0;
+    }
+
+    void set_no_delay(int fd) {
+        int flag = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+    }
+
+    void send_all(int fd, const void* data, size_t bytes) {
+        const char* cursor = static_cast<const char*>(data);
+        while (bytes > 0) {
+            ssize_t sent = send(fd, cursor, bytes, MSG_NOSIGNAL);
+            if (sent <= 0) {
+                throw std::runtime_error("Lost the connection to the next rank.");
+            }
+            cursor += sent;
+            bytes -= static_cast<size_t>(sent);
+        }
+    }
+
+    void receive_all(int fd, void* data, size_t bytes) {
+        char* cursor = static_cast<char*>(data);
+        while (bytes > 0) {
+            ssize_t received = recv(fd, cursor, bytes, 0);
+            if (received <= 0) {
+                throw std::runtime_error("Lost the connection to the previous rank.");
+            }
+            cursor += received;
+            bytes -= static_cast<size_t>(received);
+        }
+    }
+}
+
+TcpCommunicator::TcpCommunicator(size_t rank, size_t world_size, const std::vector<std::string>& addresses,
+                                 uint16_t base_port, std::chrono::milliseconds timeout)
+    : Communicator(rank, world_size) {
+    if (addresses.size() != world_size) {
+        throw std::invalid_argument("Expected one address per rank.");
+    }
+    if (world_size == 1) {
+        return;
+    }
+
+    auto deadline = Clock::now() + timeout;
+    size_t successor = (rank + 1) % world_size;
+    size_t predecessor = (rank + world_size - 1) % world_size;
+
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (listener < 0) {
+        throw std::runtime_error("Unable to create a socket.");
+    }
+    int reuse = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    sockaddr_in own = make_address("0.0.0.0", static_cast<uint16_t>(base_port + rank));
+    if (bind(listener, reinterpret_cast<sockaddr*>(&own), sizeof(own)) != 0 || listen(listener, 4) != 0) {
+        close(listener);
+        throw std::runtime_error("Unable to listen on port " + std::to_string(base_port + rank));
+    }
+
+    try {
+        // Connecting succeeds as soon as the successor listens, before it accepts, so
+        // every rank can connect first and accept afterwards.
+        sockaddr_in target = make_address(addresses[successor], static_cast<uint16_t>(base_port + successor));
+        while (successor_socket < 0) {
+            int fd = socket(AF_INET, SOCK_STREAM, 0);
+            if (connect(fd, reinterpret_cast<sockaddr*>(&target), sizeof(target)) == 0) {
+                successor_socket = fd;
+                break;
+            }
+            close(fd);
+            if (Clock::now() >= deadline) {
+                throw std::runtime_error("Timed out connecting to rank " + std::to_string(successor));
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        set_no_delay(successor_socket);
+        uint64_t own_rank = rank;
+        send_all(successor_socket, &own_rank, sizeof(own_rank));
+
+        pollfd waiting{listener, POLLIN, 0};
+        if (poll(&waiting, 1, milliseconds_left(deadline)) <= 0) {
+            throw std::runtime_error("Timed out waiting for rank " + std::to_string(predecessor));
+        }
+        predecessor_socket = accept(listener, nullptr, nullptr);
+        if (predecessor_socket < 0) {
+            throw std::runtime_error("Unable to accept the connection of rank " + std::to_string(predecessor));
+        }
+        set_no_delay(predecessor_socket);
+        uint64_t peer_rank = 0;
+        receive_all(predecessor_socket, &peer_rank, sizeof(peer_rank));
+        if (peer_rank != predecessor) {
+            throw std::runtime_error("Rank " + std::to_string(peer_rank) + " connected instead of rank "
+                                     + std::to_string(predecessor));
+        }
+    } catch (...) {
+        close(listener);
+        close_sockets();
+        throw;
+    }
+    close(listener);
+}
+
+TcpCommunicator::TcpCommunicator(size_t rank, size_t world_size, uint16_t base_port)
+    : TcpCommunicator(rank, world_size, std::vector<std::string>(world_size, "127.0.0.1"), base_port) {}
+
+TcpCommunicator::~TcpCommunicator() {
+    close_sockets();
+}
+
+void TcpCommunicator::close_sockets() {
+    if (successor_socket >= 0) {
+        close(successor_socket);
+        successor_socket = -1;
+    }
+    if (predecessor_socket >= 0) {
+        close(predecessor_socket);
+        predecessor_socket = -1;
+    }
+}
+
+void TcpCommunicator::ring_exchange(const void* send_data, size_t send_bytes, void* receive_data, size_t receive_bytes) {
+    const char* send_cursor = static_cast<const char*>(send_data);
+    char* receive_cursor = static_cast<char*>(receive_data);
+
+    while (send_bytes > 0 || receive_bytes > 0) {
+        pollfd links[2];
+        nfds_t count = 0;
+        if (send_bytes > 0) {
+            links[count++] = {successor_socket, POLLOUT, 0};
+        }
+        if (receive_bytes > 0) {
+            links[count++] = {predecessor_socket, POLLIN, 0};
+        }
+        if (poll(links, count, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error("Polling the ring links failed.");
+        }
+
+        for (nfds_t i = 0; i < count; ++i) {
+            if (links[i].revents == 0) {
+                continue;
+            }
+            if (links[i].fd == successor_socket && send_bytes > 0) {
+                ssize_t sent = send(successor_socket, send_cursor, send_bytes, MSG_NOSIGNAL | MSG_DONTWAIT);
+                if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+                    continue;
+                }
+                if (sent <= 0) {
+                    throw std::runtime_error("Lost the connection to the next rank.");
+                }
+                send_cursor += sent;
+                send_bytes -= static_cast<size_t>(sent);
+            } else if (links[i].fd == predecessor_socket && receive_bytes > 0) {
+                ssize_t received = recv(predecessor_socket, receive_cursor, receive_bytes, MSG_DONTWAIT);
+                if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+                    continue;
+                }
+                if (received <= 0) {
+                    throw std::runtime_error("Lost the connection to the previous rank.");
+                }
+                receive_cursor += received;
+                receive_bytes -= static_cast<size_t>(received);
+            }
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef TCPCOMMUNICATOR_H
+#define TCPCOMMUNICATOR_H
+
+#include "Communicator.h"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class TcpCommunicator
+ * @brief Communicator whose ring links are TCP connections, for ranks on one or more hosts.
+ *
+ * Rank r listens on base_port + r, connects to its successor and accepts the connection of
+ * its predecessor. Ranks may start in any order; connecting is retried until the timeout.
+ * Values are sent in their in-memory representation, so all hosts must share the same
+ * long double format.
+ */
+class TcpCommunicator : public Communicator {
+private:
+    int successor_socket = -1;
+    int predecessor_socket = -1;
+
+    /**
+     * @brief Closes both ring links.
+     */
+    void close_sockets();
+
+public:
+    /**
+     * @brief Constructor for TcpCommunicator; blocks until both ring links are established.
+     * @param rank This process's rank.
+     * @param world_size Number of ranks.
+     * @param addresses IPv4 address of every rank, indexed by rank.
+     * @param base_port Rank r listens on base_port + r.
+     * @param timeout How long to wait for the neighbours.
+     * @throws std::invalid_argument if addresses does not have world_size entries.
+     * @throws std::runtime_error if a link cannot be established in time.
+     */
+    TcpCommunicator(size_t rank, size_t world_size, const std::vector<std::string>& addresses,
+                    uint16_t base_port = 29500,
+                    std::chrono::milliseconds timeout = std::chrono::milliseconds(30000));
+
+    /**
+     * @brief Constructor for TcpCommunicator with every rank on this host.
+     * @param rank This process's rank.
+     * @param world_size Number of ranks.
+     * @param base_port Rank r listens on base_port + r.
+     */
+    TcpCommunicator(size_t rank, size_t world_size, uint16_t base_port = 29500);
+
+    /**
+     * @brief Closes the ring links.
+     */
+    ~TcpCommunicator() override;
+
+    /**
+     * @brief Sends to the successor and receives from the predecessor concurrently.
+     * @throws std::runtime_error if a neighbour disconnects.
+     */
+    void ring_exchange(const void* send_data, size_t send_bytes, void* receive_data, size_t receive_bytes) override;
+};
+
+#endif // TCPCOMMUNICATOR_H
@@ -0,0 +1,74 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads running submitted tasks in submission order.
+ *
+ * Tasks are taken by whichever worker becomes free first, so long and short jobs share the
+ * cores without any static partitioning. Exceptions thrown by a task are delivered through
+ * the future returned by submit.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable task_ready;
+    bool stopping = false;
+
+    /**
+     * @brief Worker thread body.
+     */
+    void run();
+
+public:
+    /**
+     * @brief Constructor for ThreadPool; starts the workers.
+     * @param num_threads Number of workers (0 uses every hardware thread).
+     */
+    explicit ThreadPool(size_t num_threads = 0);
+
+    /**
+     * @brief Finishes the queued tasks and joins the workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Returns the number of workers.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Queues a task.
+     * @param task Callable without arguments.
+     * @return Future for the task's result.
+     */
+    template <typename Task>
+    std::future<std::invoke_result_t<Task>> submit(Task task) {
+        using Result = std::invoke_result_t<Task>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::move(task));
+        std::future<Result> result = packaged->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.emplace_back([packaged] { (*packaged)(); });
+        }
+        task_ready.notify_one();
+        return result;
+    }
+};
+
+#endif // THREADPOOL_H
@@ -5,7 +5,7 @@
 #include "ActivationLayer.h"
 #include "Activations.h"
 #include "LearningFacade.h"
-#include "BCELoss.h"
+#include "BCEWithLogitsLoss.h"
 
 #include <iostream>
 #include <memory>
@@ -33,9 +33,8 @@ int main() {
         model.add_module(std::make_shared<LinearLayer>(64, 32));
         model.add_module(std::make_shared<ActivationLayer>(Activations::tanh, Activations::tanh_derivative));
         model.add_module(std::make_shared<LinearLayer>(32, 1));
-        model.add_module(std::make_shared<ActivationLayer>(Activations::sigmoid, Activations::sigmoid_derivative));
 
-        auto loss_function = std::make_shared<BinaryCrossEntropyLoss>();
+        auto loss_function = std::make_shared<BCEWithLogitsLoss>();
 
         LearningFacade learning_facade(model, loss_function, 100);
 
@@ -0,0 +1,79 @@
+#include "DataFrameUtils.h"
+#include "DataFrameIterator.h"
+#include "SequentialNN.h"
+#include "LinearLayer.h"
+#include "ActivationLayer.h"
+#include "Activations.h"
+#include "LearningFacade.h"
+#include "BCEWithLogitsLoss.h"
+#include "TcpCommunicator.h"
+#include "SharedMemoryCommunicator.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+// Usage: distributed <rank> <world_size> [tcp|shm]
+// Start one process per rank, e.g.:
+//   for r in 0 1 2 3; do ./distributed $r 4 shm & done; wait
+int main(int argc, char** argv) {
+    try {
+        if (argc < 3) {
+            std::cerr << "Usage: " << argv[0] << " <rank> <world_size> [tcp|shm]" << std::endl;
+            return 1;
+        }
+        size_t rank = std::stoul(argv[1]);
+        size_t world_size = std::stoul(argv[2]);
+        std::string transport = argc > 3 ? argv[3] : "tcp";
+
+        std::shared_ptr<Communicator> communicator;
+        if (transport == "shm") {
+            communicator = std::make_shared<SharedMemoryCommunicator>(rank, world_size, "dl_sample_ring");
+        } else {
+            communicator = std::make_shared<TcpCommunicator>(rank, world_size);
+        }
+
+        std::string file_path = "../datasets/cancer/data.json";
+        DataFrame data = DataFrameUtils::df_from_json(file_path);
+
+        std::unique_ptr<DataFrame> target = data.dataframe_from_column("Column_2");
+        data.drop_columns({"Column_2"});
+
+        // The same seed gives every rank the same split. Each rank trains on its own shard of
+        // the training rows; rank 0 then tests the averaged model on the held-out rows.
+        auto [train_data, test_data, train_target, test_target] =
+            DataFrameUtils::train_test_split(data, *target, 0.2f, 42);
+        DataFrame shard_data = DataFrameUtils::shard(train_data, rank, world_size);
+        DataFrame shard_target = DataFrameUtils::shard(train_target, rank, world_size);
+
+        auto train_loader = shard_data.create_iterator();
+        auto target_loader = shard_target.create_iterator();
+        auto test_loader = test_data.create_iterator();
+        auto test_target_loader = test_target.create_iterator();
+
+        Sequential model;
+        model.add_module(std::make_shared<LinearLayer>(data.column_count(), 64));
+        model.add_module(std::make_shared<ActivationLayer>(Activations::tanh, Activations::tanh_derivative));
+        model.add_module(std::make_shared<LinearLayer>(64, 32));
+        model.add_module(std::make_shared<ActivationLayer>(Activations::tanh, Activations::tanh_derivative));
+        model.add_module(std::make_shared<LinearLayer>(32, 1));
+
+        auto loss_function = std::make_shared<BCEWithLogitsLoss>();
+
+        LearningFacade learning_facade(model, loss_function, 100);
+        learning_facade.set_distributed(communicator);
+
+        learning_facade.train(*train_loader, *target_loader, 0.01L);
+
+        if (rank == 0) {
+            std::cout << "Starting testing process..." << std::endl;
+            learning_facade.test(*test_loader, *test_target_loader);
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include "codegen_model.h"
+#include "ModelCodeGenerator.h"
+#include "model_float.h"
+#include "model_double.h"
+#include "model_long_double.h"
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    size_t failures = 0;
+
+    void expect(bool condition, const std::string& message) {
+        if (!condition) {
+            std::cerr << "FAILED: " << message << "\n";
+            ++failures;
+        }
+    }
+
+    // Runs generated predict() and returns its outputs widened to long double.
+    template <typename Scalar>
+    std::vector<long double> run_generated(void (*predict)(const Scalar*, Scalar*), const std::vector<long double>& input,
+                                           size_t output_size) {
+        std::vector<Scalar> in(input.begin(), input.end());
+        std::vector<Scalar> out(output_size);
+        predict(in.data(), out.data());
+        return std::vector<long double>(out.begin(), out.end());
+    }
+
+    void compare(const std::string& name, const std::vector<long double>& expected,
+                 const std::vector<long double>& actual, long double tolerance) {
+        for (size_t i = 0; i < expected.size(); ++i) {
+            long double error = std::fabs(expected[i] - actual[i]);
+            if (!(error <= tolerance * std::max(1.0L, std::fabs(expected[i])))) {
+                std::cerr << name << " output " << i << ": expected " << static_cast<double>(expected[i])
+                          << ", got " << static_cast<double>(actual[i]) << "\n";
+                expect(false, name + " differs from Sequential::forward");
+                return;
+            }
+        }
+    }
+
+    bool rejects(const Sequential& model, GeneratedPrecision precision) {
+        try {
+            ModelCodeGenerator("rejected", precision).generate(model);
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    }
+}
+
+// Compares the code generated by codegen_generate with Sequential::forward on the same model,
+// and checks that weights without a literal in the generated type are rejected.
+int main() {
+    Sequential model = make_codegen_model();
+    expect(model_long_double::input_size == 7 && model_long_double::output_size == 3,
+           "generated sizes match the model");
+
+    for (size_t row = 0; row < 50; ++row) {
+        std::vector<long double> input(model_long_double::input_size);
+        for (size_t j = 0; j < input.size(); ++j) {
+            input[j] = 2.0L * std::sin(0.91L * static_cast<long double>(row * input.size() + j) + 0.5L);
+        }
+        std::vector<long double> expected = model.forward(input);
+        expect(expected.size() == model_long_double::output_size, "forward returns output_size values");
+
+        compare("long double", expected, run_generated(model_long_double::predict, input, expected.size()), 0.0L);
+        compare("double", expected, run_generated(model_double::predict, input, expected.size()), 1e-12L);
+        compare("float", expected, run_generated(model_float::predict, input, expected.size()), 1e-5L);
+    }
+
+    const auto& linear = dynamic_cast<const LinearLayer&>(*model.get_modules()[2]);
+    ParameterView weights = linear.get_weights();
+    long double saved = weights[3];
+
+    weights[3] = std::numeric_limits<long double>::quiet_NaN();
+    expect(rejects(model, GeneratedPrecision::LongDouble), "NaN weight is rejected");
+    weights[3] = -std::numeric_limits<long double>::infinity();
+    expect(rejects(model, GeneratedPrecision::Double), "infinite weight is rejected");
+    weights[3] = 1e300L;
+    expect(rejects(model, GeneratedPrecision::Float), "weight overflowing float is rejected");
+    expect(!rejects(model, GeneratedPrecision::Double), "weight within double range is exported");
+    weights[3] = saved;
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "codegen_check: all checks passed\n";
+    return 0;
+}
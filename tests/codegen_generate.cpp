@@ -0,0 +1,25 @@
+#include "codegen_model.h"
+#include "ModelCodeGenerator.h"
+#include <exception>
+#include <iostream>
+#include <string>
+
+// Writes the model of codegen_model.h in every precision into the directory given as argument.
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::cerr << "usage: codegen_generate <output directory>\n";
+        return 2;
+    }
+    std::string directory = argv[1];
+
+    try {
+        Sequential model = make_codegen_model();
+        ModelCodeGenerator("model_float", GeneratedPrecision::Float).write(model, directory + "/model_float.h");
+        ModelCodeGenerator("model_double", GeneratedPrecision::Double).write(model, directory + "/model_double.h");
+        ModelCodeGenerator("model_long_double", GeneratedPrecision::LongDouble).write(model, directory + "/model_long_double.h");
+    } catch (const std::exception& e) {
+        std::cerr << "codegen_generate: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
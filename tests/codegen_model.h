@@ -0,0 +1,49 @@
+#ifndef CODEGEN_MODEL_H
+#define CODEGEN_MODEL_H
+
+#include "SequentialNN.h"
+#include "LinearLayer.h"
+#include "ActivationLayer.h"
+#include "Activations.h"
+#include <cmath>
+#include <memory>
+
+/**
+ * @brief Builds the model exported by codegen_generate and checked by codegen_check.
+ * Weights follow a fixed formula, so both programs build the same model.
+ * Every built-in activation appears once.
+ */
+inline Sequential make_codegen_model() {
+    const size_t sizes[] = {7, 12, 9, 5, 3};
+    Sequential model;
+    for (size_t l = 0; l + 1 < sizeof(sizes) / sizeof(sizes[0]); ++l) {
+        auto linear = std::make_shared<LinearLayer>(sizes[l], sizes[l + 1]);
+        ParameterView weights = linear->get_weights();
+        for (size_t i = 0; i < weights.size; ++i) {
+            weights[i] = 0.6L * std::sin(0.37L * static_cast<long double>(i + 1) + static_cast<long double>(l));
+        }
+        ParameterView biases = linear->get_biases();
+        for (size_t i = 0; i < biases.size; ++i) {
+            biases[i] = 0.1L * std::cos(1.3L * static_cast<long double>(i) - static_cast<long double>(l));
+        }
+        model.add_module(linear);
+
+        switch (l) {
+            case 0:
+                model.add_module(std::make_shared<ActivationLayer>(Activations::relu, Activations::relu_derivative));
+                break;
+            case 1:
+                model.add_module(std::make_shared<ActivationLayer>(Activations::tanh, Activations::tanh_derivative));
+                break;
+            case 2:
+                model.add_module(std::make_shared<ActivationLayer>(Activations::sigmoid, Activations::sigmoid_derivative));
+                break;
+            default:
+                model.add_module(std::make_shared<ActivationLayer>(Activations::identity, Activations::identity_derivative));
+                break;
+        }
+    }
+    return model;
+}
+
+#endif // CODEGEN_MODEL_H
@@ -0,0 +1,125 @@
+#include "DataFrameUtils.h"
+#include "SequentialNN.h"
+#include "LinearLayer.h"
+#include "MixedPrecisionLinearLayer.h"
+#include "ActivationLayer.h"
+#include "Activations.h"
+#include "BCEWithLogitsLoss.h"
+#include "LearningFacade.h"
+#include "SGD.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifndef TEST_DATASET_DIR
+#define TEST_DATASET_DIR "datasets"
+#endif
+
+namespace {
+    const size_t EPOCHS = 8;
+    const size_t HIDDEN = 16;
+
+    size_t failures = 0;
+
+    void expect(bool condition, const std::string& message) {
+        if (!condition) {
+            std::cerr << "FAILED: " << message << "\n";
+            ++failures;
+        }
+    }
+
+    // Same seed, same initial weights: every variant starts from these layers.
+    std::vector<std::shared_ptr<LinearLayer>> make_layers(size_t inputs, uint32_t seed) {
+        std::mt19937 generator(seed);
+        std::vector<std::shared_ptr<LinearLayer>> layers = {
+            std::make_shared<LinearLayer>(inputs, HIDDEN), std::make_shared<LinearLayer>(HIDDEN, 1)};
+        for (const auto& layer : layers) {
+            std::normal_distribution<double> weight(0.0, std::sqrt(2.0 / layer->get_input_size()));
+            for (long double& w : layer->get_weights()) {
+                w = weight(generator);
+            }
+            for (long double& b : layer->get_biases()) {
+                b = 0.0L;
+            }
+        }
+        return layers;
+    }
+
+    template <typename MakeLinear>
+    Sequential make_model(const std::vector<std::shared_ptr<LinearLayer>>& layers, MakeLinear make_linear) {
+        Sequential model;
+        model.add_module(make_linear(*layers[0]));
+        model.add_module(std::make_shared<ActivationLayer>(Activations::relu, Activations::relu_derivative));
+        model.add_module(make_linear(*layers[1]));
+        return model;
+    }
+
+    // Trains the model and returns its average training loss per epoch.
+    std::vector<double> train(Sequential& model, const DataFrame& data, const DataFrame& target, bool loss_scaling) {
+        LearningFacade facade(model, std::make_shared<BCEWithLogitsLoss>(), EPOCHS);
+        facade.set_terminal_display(false);
+        if (loss_scaling) {
+            facade.set_loss_scaling();
+        }
+        auto train_loader = data.create_iterator();
+        auto target_loader = target.create_iterator();
+        SGD optimizer(0.01L, 0.9L);
+        facade.train(*train_loader, *target_loader, optimizer, 8);
+        facade.get_loss_publisher().flush();
+
+        std::vector<double> losses;
+        for (const auto& [loss, epoch] : facade.get_loss_publisher().get_losses()) {
+            losses.push_back(loss);
+        }
+        return losses;
+    }
+
+    void compare(const std::string& name, const std::vector<double>& reference, const std::vector<double>& losses,
+                 double tolerance) {
+        expect(losses.size() == reference.size(), name + " reports one loss per epoch");
+        for (size_t e = 0; e < std::min(losses.size(), reference.size()); ++e) {
+            std::cout << name << " epoch " << e + 1 << ": " << losses[e] << " (reference " << reference[e] << ")\n";
+            expect(std::isfinite(losses[e]), name + " loss is finite");
+            expect(std::fabs(losses[e] - reference[e]) <= tolerance * reference[e],
+                   name + " loss of epoch " + std::to_string(e + 1) + " is within "
+                   + std::to_string(tolerance * 100.0) + "% of LinearLayer");
+        }
+    }
+}
+
+// Trains one model with LinearLayers and the same model with MixedPrecisionLinearLayers
+// (float32 and bfloat16 storage, with dynamic loss scaling) from the same initial weights,
+// and checks that the mixed-precision losses track the long double ones.
+int main() {
+    DataFrame data = DataFrameUtils::df_from_json(std::string(TEST_DATASET_DIR) + "/cancer/data.json");
+    auto target = data.dataframe_from_column("Column_2");
+    data.drop_columns({"Column_2"});
+
+    auto layers = make_layers(data.column_count(), 7);
+
+    Sequential reference_model = make_model(layers, [](const LinearLayer& layer) {
+        return layer.clone();
+    });
+    std::vector<double> reference = train(reference_model, data, *target, false);
+    expect(reference.size() == EPOCHS && reference.back() < 0.5 * reference.front(), "LinearLayer model learns");
+
+    const std::pair<StoragePrecision, double> variants[] = {
+        {StoragePrecision::Float32, 0.001}, {StoragePrecision::BFloat16, 0.01}};
+    for (const auto& [precision, tolerance] : variants) {
+        Sequential model = make_model(layers, [precision = precision](const LinearLayer& layer) {
+            return std::make_shared<MixedPrecisionLinearLayer>(layer, precision);
+        });
+        compare(precision == StoragePrecision::Float32 ? "float32" : "bfloat16", reference,
+                train(model, data, *target, true), tolerance);
+    }
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "mixed_precision_check: all checks passed\n";
+    return 0;
+}